@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Real-time Capture Worker
+ */
+
+#include "audio_capture_worker.h"
+
+#include <algorithm>
+#include <vector>
+#include "audio_kernels.h"
+#include "../audio_processing_module.h"
+#include "../../utils/logger.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+// Statistics are published once a second and logged every five seconds
+constexpr int64_t kFramesPerPublish = 100;
+constexpr int64_t kFramesPerLog = 500;
+// Assumed time between the microphone and QAudioSource handing us samples
+constexpr int kDeviceLatencyMs = 10;
+
+QString describe(const CaptureStatsSnapshot& stats) {
+    return QString("callbacks %1 (mean %2 ms, max %3 ms, jitter %4 ms), "
+                   "frames %5 (mean %6 us, max %7 us, over budget %8), "
+                   "overruns %9 (%10 samples dropped)")
+        .arg(stats.callbacks)
+        .arg(stats.meanCallbackIntervalMs, 0, 'f', 2)
+        .arg(stats.maxCallbackIntervalMs, 0, 'f', 2)
+        .arg(stats.jitterMs, 0, 'f', 2)
+        .arg(stats.framesProcessed)
+        .arg(stats.meanProcessingUs, 0, 'f', 1)
+        .arg(stats.maxProcessingUs, 0, 'f', 1)
+        .arg(stats.framesOverBudget)
+        .arg(stats.overruns)
+        .arg(stats.droppedSamples);
+}
+
+bool toSampleFormat(QAudioFormat::SampleFormat format, SampleFormat* out) {
+    switch (format) {
+        case QAudioFormat::UInt8:
+            *out = SampleFormat::UInt8;
+            return true;
+        case QAudioFormat::Int16:
+            *out = SampleFormat::Int16;
+            return true;
+        case QAudioFormat::Int32:
+            *out = SampleFormat::Int32;
+            return true;
+        case QAudioFormat::Float:
+            *out = SampleFormat::Float;
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+AudioCaptureWorker::AudioCaptureWorker(QObject* parent)
+    : QObject(parent),
+      voiceActivity_(std::make_shared<VoiceActivityDetector>()) {}
+
+AudioCaptureWorker::~AudioCaptureWorker() {
+    stop();
+}
+
+bool AudioCaptureWorker::start(const QAudioDevice& device,
+                               const QAudioFormat& format,
+                               std::shared_ptr<livekit::AudioSource> audioSource,
+                               AudioProcessingModule* apm) {
+    stop();
+    muted_.store(false, std::memory_order_relaxed);
+
+    if (!configureConverter(format)) {
+        return false;
+    }
+
+    format_ = format;
+    livekitAudioSource_ = std::move(audioSource);
+    apm_ = apm;
+
+    // Size the reusable 10ms frame once; sendBufferedFrames() only refills it
+    captureFrame_ = livekit::AudioFrame(
+        std::vector<int16_t>(static_cast<size_t>(kFrameSizeSamples) * kProcessingChannels),
+        kProcessingRate, kProcessingChannels, kFrameSizeSamples);
+    audioBuffer_.clear();
+    switchScratch_.assign(audioBuffer_.capacity() * 2, 0);
+    stats_.reset(format_.sampleRate());
+    framesSincePublish_ = 0;
+    framesSinceLog_ = 0;
+    publishStatistics();
+
+    // Created here so the device and its QIODevice belong to this thread
+    audioSource_ = std::make_unique<QAudioSource>(device, format_);
+    connect(audioSource_.get(), &QAudioSource::stateChanged,
+            this, &AudioCaptureWorker::onStateChanged);
+
+    audioInput_ = audioSource_->start();
+    if (!audioInput_) {
+        Logger::instance().error("Failed to start audio input");
+        audioSource_.reset();
+        livekitAudioSource_.reset();
+        return false;
+    }
+
+    connect(audioInput_, &QIODevice::readyRead, this, &AudioCaptureWorker::onReadyRead);
+    clock_.start();
+    return true;
+}
+
+void AudioCaptureWorker::stop() {
+    if (pendingSource_) {
+        abandonSwitch("capture stopped");
+    }
+    if (!audioSource_) {
+        return;
+    }
+
+    audioSource_->stop();
+    audioInput_ = nullptr;
+    audioSource_.reset();
+    livekitAudioSource_.reset();
+    audioBuffer_.clear();
+    if (voiceActivity_->reset()) {
+        emit speakingChanged(false);
+    }
+
+    publishStatistics();
+    Logger::instance().info(QString("Audio capture thread stopped: %1").arg(describe(published_)));
+}
+
+bool AudioCaptureWorker::switchDevice(const QAudioDevice& device, const QAudioFormat& format, int generation) {
+    if (!audioSource_) {
+        return false;
+    }
+    if (pendingSource_) {
+        abandonSwitch("superseded by another switch");
+    }
+
+    SampleFormat sampleFormat;
+    if (!toSampleFormat(format.sampleFormat(), &sampleFormat)) {
+        Logger::instance().error(QString("Unsupported microphone format (sample format: %1)")
+                                     .arg(static_cast<int>(format.sampleFormat())));
+        return false;
+    }
+
+    pendingSource_ = std::make_unique<QAudioSource>(device, format);
+    pendingInput_ = pendingSource_->start();
+    if (!pendingInput_) {
+        Logger::instance().error(QString("Failed to open microphone '%1' for switching")
+                                     .arg(device.description()));
+        pendingSource_.reset();
+        return false;
+    }
+
+    pendingFormat_ = format;
+    pendingGeneration_ = generation;
+    connect(pendingInput_, &QIODevice::readyRead, this, &AudioCaptureWorker::onPendingReadyRead);
+    switchClock_.start();
+    Logger::instance().info(QString("Opened microphone '%1' alongside the current one, waiting for data")
+                                .arg(device.description()));
+    return true;
+}
+
+CaptureStatsSnapshot AudioCaptureWorker::statistics() const {
+    std::lock_guard<std::mutex> lock(publishedMutex_);
+    return published_;
+}
+
+void AudioCaptureWorker::onReadyRead() {
+    if (!audioInput_) {
+        return;
+    }
+
+    readFromDevice();
+    sendBufferedFrames();
+
+    if (pendingInput_ && switchClock_.elapsed() > kSwitchTimeoutMs) {
+        abandonSwitch("no data from the new device");
+    }
+}
+
+void AudioCaptureWorker::onPendingReadyRead() {
+    if (!pendingInput_) {
+        return;
+    }
+    const qint64 bytesPerFrame = static_cast<qint64>(pendingFormat_.bytesPerFrame());
+    if (bytesPerFrame > 0 && pendingInput_->bytesAvailable() >= bytesPerFrame) {
+        completeSwitch();
+    }
+}
+
+void AudioCaptureWorker::completeSwitch() {
+    // Last data from the old device; sendBufferedFrames() has been holding
+    // back at least kCrossfadeSamples of it since the switch began
+    readFromDevice();
+    const size_t oldCount = audioBuffer_.read(switchScratch_.data(), audioBuffer_.available());
+
+    disconnect(pendingInput_, &QIODevice::readyRead, this, &AudioCaptureWorker::onPendingReadyRead);
+    if (audioInput_) {
+        disconnect(audioInput_, nullptr, this, nullptr);
+    }
+    disconnect(audioSource_.get(), nullptr, this, nullptr);
+    audioSource_->stop();
+    audioSource_ = std::move(pendingSource_);
+    connect(audioSource_.get(), &QAudioSource::stateChanged,
+            this, &AudioCaptureWorker::onStateChanged);
+    audioInput_ = pendingInput_;
+    pendingInput_ = nullptr;
+
+    if (!configureConverter(pendingFormat_)) {
+        // Unreachable for formats accepted by switchDevice(); keep capture alive
+        converter_.configure(kProcessingRate, 1, SampleFormat::Int16, kDeviceChunkFrames);
+    }
+    format_ = pendingFormat_;
+    connect(audioInput_, &QIODevice::readyRead, this, &AudioCaptureWorker::onReadyRead);
+
+    // First data from the new device, spliced onto the old tail
+    readFromDevice();
+    const size_t newCount = audioBuffer_.read(switchScratch_.data() + oldCount, audioBuffer_.available());
+    const size_t fade = std::min({kCrossfadeSamples, oldCount, newCount});
+    int16_t* splice = switchScratch_.data() + oldCount - fade;
+    kernels::crossfade(splice, splice + fade, splice, fade);
+    std::copy(splice + 2 * fade, switchScratch_.data() + oldCount + newCount, splice + fade);
+
+    const size_t total = oldCount + newCount - fade;
+    const size_t written = audioBuffer_.write(switchScratch_.data(), total);
+    if (written < total) {
+        stats_.onOverrun(total - written);
+    }
+
+    Logger::instance().info(QString("Microphone switched after %1 ms (%2 samples crossfaded, rate: %3, channels: %4)")
+                                .arg(switchClock_.elapsed())
+                                .arg(fade)
+                                .arg(format_.sampleRate())
+                                .arg(format_.channelCount()));
+    sendBufferedFrames();
+    emit deviceSwitched(pendingGeneration_, true);
+}
+
+void AudioCaptureWorker::abandonSwitch(const QString& reason) {
+    if (pendingInput_) {
+        disconnect(pendingInput_, nullptr, this, nullptr);
+        pendingInput_ = nullptr;
+    }
+    if (pendingSource_) {
+        pendingSource_->stop();
+        pendingSource_.reset();
+    }
+    Logger::instance().warning(QString("Microphone switch abandoned (%1), keeping the current device").arg(reason));
+    emit deviceSwitched(pendingGeneration_, false);
+}
+
+bool AudioCaptureWorker::configureConverter(const QAudioFormat& format) {
+    SampleFormat sampleFormat;
+    if (!toSampleFormat(format.sampleFormat(), &sampleFormat)
+        || !converter_.configure(format.sampleRate(), format.channelCount(), sampleFormat,
+                                 kDeviceChunkFrames)) {
+        Logger::instance().error(QString("Unsupported microphone format (rate: %1, channels: %2, sample format: %3)")
+                                     .arg(format.sampleRate())
+                                     .arg(format.channelCount())
+                                     .arg(static_cast<int>(format.sampleFormat())));
+        return false;
+    }
+    deviceChunk_.assign(kDeviceChunkFrames * converter_.bytesPerFrame(), 0);
+    convertedChunk_.assign(converter_.maxOutputFrames(kDeviceChunkFrames), 0);
+    if (!converter_.isPassthrough()) {
+        Logger::instance().info(QString("Microphone opened in native format (rate: %1, channels: %2, sample format: %3); "
+                                        "converting to %4 Hz mono")
+                                    .arg(format.sampleRate())
+                                    .arg(format.channelCount())
+                                    .arg(static_cast<int>(format.sampleFormat()))
+                                    .arg(kProcessingRate));
+    }
+    return true;
+}
+
+void AudioCaptureWorker::onStateChanged(QAudio::State state) {
+    switch (state) {
+        case QAudio::ActiveState:
+            Logger::instance().debug("Audio state: Active");
+            break;
+        case QAudio::SuspendedState:
+            Logger::instance().debug("Audio state: Suspended");
+            break;
+        case QAudio::StoppedState:
+            if (audioSource_ && audioSource_->error() != QAudio::NoError) {
+                emit error(QString("Audio input stopped with error %1")
+                               .arg(static_cast<int>(audioSource_->error())));
+            }
+            Logger::instance().debug("Audio state: Stopped");
+            break;
+        case QAudio::IdleState:
+            Logger::instance().debug("Audio state: Idle");
+            break;
+    }
+}
+
+void AudioCaptureWorker::readFromDevice() {
+    const int64_t nowUs = clock_.nsecsElapsed() / 1000;
+    if (!converter_.isPassthrough()) {
+        readAndConvert(nowUs);
+        return;
+    }
+
+    size_t samplesRead = 0;
+
+    // Read straight into the ring buffer's free region; no intermediate QByteArray
+    while (true) {
+        auto span = audioBuffer_.writableSpan(audioBuffer_.capacity());
+        if (span.size() == 0) {
+            // Consumer fell behind: drain the device so capture keeps running
+            int16_t discard[kFrameSizeSamples];
+            const qint64 bytes = audioInput_->read(reinterpret_cast<char*>(discard), sizeof(discard));
+            if (bytes <= 0) {
+                break;
+            }
+            const size_t dropped = static_cast<size_t>(bytes) / sizeof(int16_t);
+            samplesRead += dropped;
+            stats_.onOverrun(dropped);
+            continue;
+        }
+
+        const qint64 wanted = static_cast<qint64>(span.firstSize * sizeof(int16_t));
+        const qint64 bytes = audioInput_->read(reinterpret_cast<char*>(span.first), wanted);
+        if (bytes <= 0) {
+            break;
+        }
+        const size_t samples = static_cast<size_t>(bytes) / sizeof(int16_t);
+        audioBuffer_.commitWrite(samples);
+        samplesRead += samples;
+        if (bytes < wanted) {
+            break;
+        }
+    }
+
+    if (samplesRead > 0) {
+        stats_.onDeviceData(nowUs, samplesRead / static_cast<size_t>(format_.channelCount()));
+    }
+}
+
+void AudioCaptureWorker::readAndConvert(int64_t nowUs) {
+    const qint64 bytesPerFrame = static_cast<qint64>(converter_.bytesPerFrame());
+    size_t framesRead = 0;
+
+    // Whole device frames only, at most one preallocated chunk per pass
+    while (true) {
+        const qint64 wanted = std::min<qint64>(audioInput_->bytesAvailable(),
+                                               static_cast<qint64>(deviceChunk_.size()))
+                              / bytesPerFrame * bytesPerFrame;
+        if (wanted <= 0) {
+            break;
+        }
+        const qint64 bytes = audioInput_->read(deviceChunk_.data(), wanted);
+        if (bytes <= 0) {
+            break;
+        }
+        const size_t frames = static_cast<size_t>(bytes / bytesPerFrame);
+        framesRead += frames;
+
+        const size_t produced = converter_.process(deviceChunk_.data(), frames, convertedChunk_.data());
+        const size_t written = audioBuffer_.write(convertedChunk_.data(), produced);
+        if (written < produced) {
+            // Consumer fell behind: drop the excess so capture keeps running
+            stats_.onOverrun(produced - written);
+        }
+    }
+
+    if (framesRead > 0) {
+        stats_.onDeviceData(nowUs, framesRead);
+    }
+}
+
+void AudioCaptureWorker::sendBufferedFrames() {
+    if (!livekitAudioSource_) {
+        return;
+    }
+
+    const int numChannels = kProcessingChannels;
+    const size_t frameSizeTotalSamples = static_cast<size_t>(kFrameSizeSamples) * numChannels;
+    std::vector<int16_t>& frameData = captureFrame_.data();
+    if (frameData.size() != frameSizeTotalSamples) {
+        return;
+    }
+
+    // Process all complete 10ms frames in the buffer. During a device switch
+    // the newest few ms stay behind so they can be crossfaded with the new
+    // device.
+    const size_t holdBack = pendingInput_ ? kCrossfadeSamples : 0;
+    while (audioBuffer_.available() >= frameSizeTotalSamples + holdBack) {
+        const int64_t startNs = clock_.nsecsElapsed();
+        try {
+            // Copy one frame into the preallocated LiveKit frame storage
+            audioBuffer_.read(frameData.data(), frameSizeTotalSamples);
+
+            // Process through Audio Processing Module (in-place). Samples
+            // still queued behind this frame count towards the capture side
+            // of the echo canceller's stream delay.
+            if (apm_ && apm_->isInitialized()) {
+                apm_->setCaptureDelayMs(
+                    static_cast<int>(audioBuffer_.available() / numChannels
+                                     / (kProcessingRate / 1000))
+                    + kDeviceLatencyMs);
+                apm_->processFrame(frameData.data(), kFrameSizeSamples,
+                                   kProcessingRate, numChannels);
+            }
+
+            if (muted_.load(std::memory_order_relaxed)) {
+                // Warm mute: nothing is sent and the local speaker drops out
+                if (voiceActivity_->reset()) {
+                    emit speakingChanged(false);
+                }
+            } else {
+                // Send to LiveKit
+                livekitAudioSource_->captureFrame(captureFrame_);
+
+                // Only transitions leave the capture thread
+                if (voiceActivity_->process(frameData.data(), kFrameSizeSamples,
+                                            kProcessingRate, numChannels)) {
+                    emit speakingChanged(voiceActivity_->isSpeaking());
+                }
+            }
+        } catch (const std::exception& e) {
+            Logger::instance().error(QString("Failed to capture audio: %1").arg(e.what()));
+            break;
+        }
+        stats_.onFrameProcessed((clock_.nsecsElapsed() - startNs) / 1000, kFrameBudgetUs);
+
+        if (++framesSincePublish_ >= kFramesPerPublish) {
+            framesSincePublish_ = 0;
+            publishStatistics();
+        }
+        if (++framesSinceLog_ >= kFramesPerLog) {
+            framesSinceLog_ = 0;
+            Logger::instance().debug(QString("Audio capture: %1 (buffer: %2)")
+                                         .arg(describe(stats_.snapshot()))
+                                         .arg(audioBuffer_.available()));
+        }
+    }
+}
+
+void AudioCaptureWorker::publishStatistics() {
+    const CaptureStatsSnapshot snapshot = stats_.snapshot();
+    std::lock_guard<std::mutex> lock(publishedMutex_);
+    published_ = snapshot;
+}
+
+}  // namespace audio
+}  // namespace links
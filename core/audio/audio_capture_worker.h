@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Real-time Capture Worker
+ */
+
+#ifndef AUDIO_AUDIO_CAPTURE_WORKER_H_
+#define AUDIO_AUDIO_CAPTURE_WORKER_H_
+
+#include <QAudioDevice>
+#include <QAudioFormat>
+#include <QAudioSource>
+#include <QElapsedTimer>
+#include <QIODevice>
+#include <QObject>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "livekit/audio_frame.h"
+#include "livekit/audio_source.h"
+#include "audio_ring_buffer.h"
+#include "capture_converter.h"
+#include "capture_stats.h"
+#include "voice_activity_detector.h"
+
+class AudioProcessingModule;
+
+namespace links {
+namespace audio {
+
+// Owns the QAudioSource, the sample ring and the APM stage of microphone
+// capture. The worker lives on a dedicated thread (see MicrophoneCapturer),
+// so device callbacks, APM and captureFrame never wait on the GUI event loop.
+//
+// The device is opened in whatever format it supports natively; a
+// CaptureConverter turns that into 48 kHz mono int16 before the ring, so APM
+// and LiveKit always see the processing format.
+//
+// switchDevice() opens a replacement device next to the current one. When
+// the new device delivers its first buffer the two streams are spliced with
+// a short crossfade inside the ring, so the LiveKit source (and the track
+// published from it) never sees a gap or a restart.
+//
+// While muted the device, ring and APM keep running (so AEC/AGC stay
+// converged and unmuting is instant) but no frames reach LiveKit.
+//
+// start()/stop() must be called on the worker's thread; statistics() and
+// setMuted() may be called from any thread.
+class AudioCaptureWorker : public QObject {
+    Q_OBJECT
+
+public:
+    explicit AudioCaptureWorker(QObject* parent = nullptr);
+    ~AudioCaptureWorker() override;
+
+    bool start(const QAudioDevice& device,
+               const QAudioFormat& format,
+               std::shared_ptr<livekit::AudioSource> audioSource,
+               AudioProcessingModule* apm);
+    void stop();
+    bool isActive() const { return audioInput_ != nullptr; }
+
+    // Opens |device| alongside the running one and swaps to it once it
+    // delivers data (deviceSwitched reports the outcome, tagged with
+    // |generation|). Returns false if the device cannot be opened; the
+    // current device then keeps running.
+    bool switchDevice(const QAudioDevice& device, const QAudioFormat& format, int generation);
+    bool isSwitching() const { return pendingInput_ != nullptr; }
+
+    // Takes effect on the next 10ms frame; start() always begins unmuted
+    void setMuted(bool muted) { muted_.store(muted, std::memory_order_relaxed); }
+    bool isMuted() const { return muted_.load(std::memory_order_relaxed); }
+
+    // Last statistics published by the capture thread (about once a second)
+    CaptureStatsSnapshot statistics() const;
+
+    // Speaking detector fed with the processed (post-APM) microphone signal;
+    // its state may be read from any thread
+    std::shared_ptr<const VoiceActivityDetector> voiceActivity() const { return voiceActivity_; }
+
+signals:
+    void error(const QString& message);
+    void speakingChanged(bool speaking);
+    void deviceSwitched(int generation, bool success);
+
+private slots:
+    void onReadyRead();
+    void onPendingReadyRead();
+    void onStateChanged(QAudio::State state);
+
+private:
+    bool configureConverter(const QAudioFormat& format);
+    void readFromDevice();
+    void readAndConvert(int64_t nowUs);
+    void completeSwitch();
+    void abandonSwitch(const QString& reason);
+    void sendBufferedFrames();
+    void publishStatistics();
+
+    // Processing format handed to APM and LiveKit
+    static constexpr int kProcessingRate = CaptureConverter::kOutputRate;
+    static constexpr int kProcessingChannels = 1;
+    // 10ms at 48kHz
+    static constexpr int kFrameSizeSamples = 480;
+    // 200ms of headroom in the processing format (the ring holds converted
+    // samples); rounded up to a power of two, sized once, never grows
+    static constexpr size_t kRingCapacitySamples = kProcessingRate / 5 * kProcessingChannels;
+    // Largest device read converted at once (frames in the device format)
+    static constexpr size_t kDeviceChunkFrames = 2048;
+    static constexpr int64_t kFrameBudgetUs = 10000;
+    // Old/new overlap when switching devices (5ms)
+    static constexpr size_t kCrossfadeSamples = 240;
+    // A replacement device that stays silent this long is given up
+    static constexpr int64_t kSwitchTimeoutMs = 3000;
+
+    std::unique_ptr<QAudioSource> audioSource_;
+    QIODevice* audioInput_{nullptr};
+    QAudioFormat format_;
+    std::shared_ptr<livekit::AudioSource> livekitAudioSource_;
+    AudioProcessingModule* apm_{nullptr};
+
+    AudioRingBuffer audioBuffer_{kRingCapacitySamples};
+
+    // Native device format -> processing format (unused for 48 kHz mono Int16)
+    CaptureConverter converter_;
+    std::vector<char> deviceChunk_;
+    std::vector<int16_t> convertedChunk_;
+
+    // Replacement device while a switch is in progress
+    std::unique_ptr<QAudioSource> pendingSource_;
+    QIODevice* pendingInput_{nullptr};
+    QAudioFormat pendingFormat_;
+    int pendingGeneration_{0};
+    QElapsedTimer switchClock_;
+    // Old tail + new head while the two streams are spliced
+    std::vector<int16_t> switchScratch_;
+
+    // Preallocated 10ms frame handed to APM and LiveKit (reused every frame)
+    livekit::AudioFrame captureFrame_;
+
+    std::shared_ptr<VoiceActivityDetector> voiceActivity_;
+
+    std::atomic<bool> muted_{false};
+
+    QElapsedTimer clock_;
+    CaptureStats stats_;
+    int64_t framesSincePublish_{0};
+    int64_t framesSinceLog_{0};
+
+    mutable std::mutex publishedMutex_;
+    CaptureStatsSnapshot published_;
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_AUDIO_CAPTURE_WORKER_H_
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Vectorized Sample Kernels
+ */
+
+#include "audio_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LINKS_AUDIO_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LINKS_AUDIO_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace links {
+namespace audio {
+namespace kernels {
+
+namespace {
+
+constexpr int32_t kRounding = 1 << (kGainFractionBits - 1);
+
+inline int16_t clampToInt16(int32_t value) {
+    return static_cast<int16_t>(std::min<int32_t>(INT16_MAX, std::max<int32_t>(INT16_MIN, value)));
+}
+
+}  // namespace
+
+int32_t gainToFixed(float gain) {
+    if (!(gain > 0.0f)) {
+        return 0;
+    }
+    const long fixed = std::lround(gain * static_cast<float>(kUnityGain));
+    return static_cast<int32_t>(std::min<long>(fixed, INT16_MAX));
+}
+
+void accumulateScaled(const int16_t* in, int32_t* acc, size_t count, int32_t gainQ14) {
+    size_t i = 0;
+#if defined(LINKS_AUDIO_SSE2)
+    // Each 32-bit lane holds (sample, 0); madd against (gain, 0) yields the
+    // full 32-bit product without SSE4.1's mullo.
+    const __m128i gain = _mm_set1_epi32(gainQ14 & 0xFFFF);
+    const __m128i rounding = _mm_set1_epi32(kRounding);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(samples, zero), gain);
+        __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(samples, zero), gain);
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, rounding), kGainFractionBits);
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, rounding), kGainFractionBits);
+        __m128i* dst = reinterpret_cast<__m128i*>(acc + i);
+        _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), lo));
+        _mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), hi));
+    }
+#elif defined(LINKS_AUDIO_NEON)
+    const int16_t gain = static_cast<int16_t>(gainQ14);
+    for (; i + 8 <= count; i += 8) {
+        const int16x8_t samples = vld1q_s16(in + i);
+        const int32x4_t lo = vrshrq_n_s32(vmull_n_s16(vget_low_s16(samples), gain), kGainFractionBits);
+        const int32x4_t hi = vrshrq_n_s32(vmull_n_s16(vget_high_s16(samples), gain), kGainFractionBits);
+        vst1q_s32(acc + i, vaddq_s32(vld1q_s32(acc + i), lo));
+        vst1q_s32(acc + i + 4, vaddq_s32(vld1q_s32(acc + i + 4), hi));
+    }
+#endif
+    for (; i < count; ++i) {
+        acc[i] += (static_cast<int32_t>(in[i]) * gainQ14 + kRounding) >> kGainFractionBits;
+    }
+}
+
+void saturateToInt16(const int32_t* acc, int16_t* out, size_t count) {
+    size_t i = 0;
+#if defined(LINKS_AUDIO_SSE2)
+    for (; i + 8 <= count; i += 8) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(lo, hi));
+    }
+#elif defined(LINKS_AUDIO_NEON)
+    for (; i + 8 <= count; i += 8) {
+        vst1q_s16(out + i, vcombine_s16(vqmovn_s32(vld1q_s32(acc + i)),
+                                        vqmovn_s32(vld1q_s32(acc + i + 4))));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = clampToInt16(acc[i]);
+    }
+}
+
+void sumSquaresAndPeak(const int16_t* in, size_t count, uint64_t* sumSquares, int32_t* peak) {
+    uint64_t sum = 0;
+    int32_t maxValue = 0;
+    int32_t minValue = 0;
+    size_t i = 0;
+#if defined(LINKS_AUDIO_SSE2)
+    // madd yields s0^2 + s1^2 per lane, which fits in 32 bits only when read
+    // as unsigned (2 * 32768^2 == 2^31); widen to 64-bit lanes every block.
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sum64 = _mm_setzero_si128();
+    __m128i maxv = _mm_setzero_si128();
+    __m128i minv = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i squares = _mm_madd_epi16(samples, samples);
+        sum64 = _mm_add_epi64(sum64, _mm_unpacklo_epi32(squares, zero));
+        sum64 = _mm_add_epi64(sum64, _mm_unpackhi_epi32(squares, zero));
+        maxv = _mm_max_epi16(maxv, samples);
+        minv = _mm_min_epi16(minv, samples);
+    }
+    alignas(16) uint64_t sums[2];
+    alignas(16) int16_t maxima[8];
+    alignas(16) int16_t minima[8];
+    _mm_store_si128(reinterpret_cast<__m128i*>(sums), sum64);
+    _mm_store_si128(reinterpret_cast<__m128i*>(maxima), maxv);
+    _mm_store_si128(reinterpret_cast<__m128i*>(minima), minv);
+    sum = sums[0] + sums[1];
+    for (int lane = 0; lane < 8; ++lane) {
+        maxValue = std::max<int32_t>(maxValue, maxima[lane]);
+        minValue = std::min<int32_t>(minValue, minima[lane]);
+    }
+#elif defined(LINKS_AUDIO_NEON)
+    uint64x2_t sum64 = vdupq_n_u64(0);
+    int16x8_t maxv = vdupq_n_s16(0);
+    int16x8_t minv = vdupq_n_s16(0);
+    for (; i + 8 <= count; i += 8) {
+        const int16x8_t samples = vld1q_s16(in + i);
+        const int32x4_t lo = vmull_s16(vget_low_s16(samples), vget_low_s16(samples));
+        const int32x4_t hi = vmull_s16(vget_high_s16(samples), vget_high_s16(samples));
+        sum64 = vpadalq_u32(sum64, vreinterpretq_u32_s32(lo));
+        sum64 = vpadalq_u32(sum64, vreinterpretq_u32_s32(hi));
+        maxv = vmaxq_s16(maxv, samples);
+        minv = vminq_s16(minv, samples);
+    }
+    sum = vgetq_lane_u64(sum64, 0) + vgetq_lane_u64(sum64, 1);
+    int16_t maxima[8];
+    int16_t minima[8];
+    vst1q_s16(maxima, maxv);
+    vst1q_s16(minima, minv);
+    for (int lane = 0; lane < 8; ++lane) {
+        maxValue = std::max<int32_t>(maxValue, maxima[lane]);
+        minValue = std::min<int32_t>(minValue, minima[lane]);
+    }
+#endif
+    for (; i < count; ++i) {
+        const int32_t sample = in[i];
+        sum += static_cast<uint64_t>(sample * sample);
+        maxValue = std::max(maxValue, sample);
+        minValue = std::min(minValue, sample);
+    }
+    *sumSquares = sum;
+    *peak = std::max(maxValue, -minValue);
+}
+
+void int16ToFloat(const int16_t* in, float* out, size_t count) {
+    size_t i = 0;
+#if defined(LINKS_AUDIO_SSE2)
+    for (; i + 8 <= count; i += 8) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        // Sign-extend by placing each sample in the high half and shifting back
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+        _mm_storeu_ps(out + i, _mm_cvtepi32_ps(lo));
+        _mm_storeu_ps(out + i + 4, _mm_cvtepi32_ps(hi));
+    }
+#elif defined(LINKS_AUDIO_NEON)
+    for (; i + 8 <= count; i += 8) {
+        const int16x8_t samples = vld1q_s16(in + i);
+        vst1q_f32(out + i, vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples))));
+        vst1q_f32(out + i + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples))));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = static_cast<float>(in[i]);
+    }
+}
+
+void scaleFloat(const float* in, float* out, size_t count, float scale) {
+    size_t i = 0;
+#if defined(LINKS_AUDIO_SSE2)
+    const __m128 factor = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(in + i), factor));
+    }
+#elif defined(LINKS_AUDIO_NEON)
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(out + i, vmulq_n_f32(vld1q_f32(in + i), scale));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = in[i] * scale;
+    }
+}
+
+void floatToInt16(const float* in, int16_t* out, size_t count) {
+    size_t i = 0;
+#if defined(LINKS_AUDIO_SSE2)
+    // Clamp before converting: out-of-range floats convert to INT32_MIN
+    const __m128 lower = _mm_set1_ps(static_cast<float>(INT16_MIN));
+    const __m128 upper = _mm_set1_ps(static_cast<float>(INT16_MAX));
+    for (; i + 8 <= count; i += 8) {
+        const __m128 lo = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i), lower), upper);
+        const __m128 hi = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i + 4), lower), upper);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_packs_epi32(_mm_cvtps_epi32(lo), _mm_cvtps_epi32(hi)));
+    }
+#elif defined(LINKS_AUDIO_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+    // Round-to-nearest conversion (vcvtnq) is only available on AArch64
+    const float32x4_t lower = vdupq_n_f32(static_cast<float>(INT16_MIN));
+    const float32x4_t upper = vdupq_n_f32(static_cast<float>(INT16_MAX));
+    for (; i + 8 <= count; i += 8) {
+        const float32x4_t lo = vminq_f32(vmaxq_f32(vld1q_f32(in + i), lower), upper);
+        const float32x4_t hi = vminq_f32(vmaxq_f32(vld1q_f32(in + i + 4), lower), upper);
+        vst1q_s16(out + i, vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(lo)), vqmovn_s32(vcvtnq_s32_f32(hi))));
+    }
+#endif
+    for (; i < count; ++i) {
+        const float clamped = std::min(static_cast<float>(INT16_MAX),
+                                       std::max(static_cast<float>(INT16_MIN), in[i]));
+        out[i] = static_cast<int16_t>(std::nearbyint(clamped));
+    }
+}
+
+void downmixToMono(const float* in, float* out, size_t frames, int channels) {
+    if (channels <= 1) {
+        if (out != in) {
+            std::copy(in, in + frames, out);
+        }
+        return;
+    }
+
+    size_t frame = 0;
+    if (channels == 2) {
+#if defined(LINKS_AUDIO_SSE2)
+        const __m128 half = _mm_set1_ps(0.5f);
+        for (; frame + 4 <= frames; frame += 4) {
+            const __m128 a = _mm_loadu_ps(in + frame * 2);
+            const __m128 b = _mm_loadu_ps(in + frame * 2 + 4);
+            const __m128 left = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 right = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(out + frame, _mm_mul_ps(_mm_add_ps(left, right), half));
+        }
+#elif defined(LINKS_AUDIO_NEON)
+        for (; frame + 4 <= frames; frame += 4) {
+            const float32x4x2_t lr = vld2q_f32(in + frame * 2);
+            vst1q_f32(out + frame, vmulq_n_f32(vaddq_f32(lr.val[0], lr.val[1]), 0.5f));
+        }
+#endif
+    }
+
+    const float scale = 1.0f / static_cast<float>(channels);
+    for (; frame < frames; ++frame) {
+        const float* samples = in + frame * static_cast<size_t>(channels);
+        float sum = 0.0f;
+        for (int c = 0; c < channels; ++c) {
+            sum += samples[c];
+        }
+        out[frame] = sum * scale;
+    }
+}
+
+float dotProduct(const float* a, const float* b, size_t count) {
+    size_t i = 0;
+    float sum = 0.0f;
+#if defined(LINKS_AUDIO_SSE2)
+    // Two accumulators hide the add latency
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    for (; i + 8 <= count; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, _mm_add_ps(acc0, acc1));
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(LINKS_AUDIO_NEON)
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    for (; i + 8 <= count; i += 8) {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    const float32x4_t acc = vaddq_f32(acc0, acc1);
+    sum = (vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1)) + (vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3));
+#endif
+    for (; i < count; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+void crossfade(const int16_t* from, const int16_t* to, int16_t* out, size_t count) {
+    // Gain of |to| rises from 1/(count+1) to count/(count+1), so neither end
+    // repeats a sample at full weight
+    const float step = 1.0f / static_cast<float>(count + 1);
+    for (size_t i = 0; i < count; ++i) {
+        const float gain = step * static_cast<float>(i + 1);
+        const float mixed = static_cast<float>(from[i]) * (1.0f - gain)
+                            + static_cast<float>(to[i]) * gain;
+        out[i] = static_cast<int16_t>(std::lrint(mixed));
+    }
+}
+
+const char* simdBackend() {
+#if defined(LINKS_AUDIO_SSE2)
+    return "sse2";
+#elif defined(LINKS_AUDIO_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+}  // namespace kernels
+}  // namespace audio
+}  // namespace links
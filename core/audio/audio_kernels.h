@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Vectorized Sample Kernels
+ */
+
+#ifndef AUDIO_AUDIO_KERNELS_H_
+#define AUDIO_AUDIO_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace links {
+namespace audio {
+namespace kernels {
+
+// Gains are applied in Q14 fixed point, so the usable range is [0, 2)
+constexpr int kGainFractionBits = 14;
+constexpr int32_t kUnityGain = 1 << kGainFractionBits;
+
+int32_t gainToFixed(float gain);
+
+// acc[i] += round(in[i] * gain / 2^14)
+void accumulateScaled(const int16_t* in, int32_t* acc, size_t count, int32_t gainQ14);
+
+// out[i] = clamp(acc[i], INT16_MIN, INT16_MAX)
+void saturateToInt16(const int32_t* acc, int16_t* out, size_t count);
+
+// Sum of squares and absolute peak of |count| samples, for level metering and
+// voice activity detection. The peak of INT16_MIN is reported as 32768.
+void sumSquaresAndPeak(const int16_t* in, size_t count, uint64_t* sumSquares, int32_t* peak);
+
+// Float stage of capture conversion. Float samples use the int16 scale
+// (full scale == 32768) so conversions in and out are plain casts.
+
+// out[i] = in[i]
+void int16ToFloat(const int16_t* in, float* out, size_t count);
+
+// out[i] = in[i] * scale
+void scaleFloat(const float* in, float* out, size_t count, float scale);
+
+// out[i] = clamp(round(in[i]), INT16_MIN, INT16_MAX)
+void floatToInt16(const float* in, int16_t* out, size_t count);
+
+// Averages |channels| interleaved channels into one; |out| may alias |in|
+void downmixToMono(const float* in, float* out, size_t frames, int channels);
+
+// sum(a[i] * b[i])
+float dotProduct(const float* a, const float* b, size_t count);
+
+// Linear crossfade from |from| to |to| over |count| samples; |out| may alias
+// either input. Scalar only: it runs once per device switch.
+void crossfade(const int16_t* from, const int16_t* to, int16_t* out, size_t count);
+
+// Name of the instruction set the kernels were built for ("sse2", "neon", "scalar")
+const char* simdBackend();
+
+}  // namespace kernels
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_AUDIO_KERNELS_H_
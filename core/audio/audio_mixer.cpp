@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Remote Track Mixer
+ */
+
+#include "audio_mixer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "audio_kernels.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+size_t samplesForMs(int rate, int channels, int ms) {
+    return static_cast<size_t>(rate) * static_cast<size_t>(channels) * ms / 1000;
+}
+
+}  // namespace
+
+AudioMixer::Track::Track(std::string id, int outputRate, int outputChannels)
+    : id_(std::move(id)),
+      outputRate_(outputRate),
+      outputChannels_(outputChannels),
+      jitter_(outputRate, outputChannels),
+      gainQ14_(kernels::kUnityGain) {}
+
+void AudioMixer::Track::setGain(float gain) {
+    gainQ14_.store(kernels::gainToFixed(gain), std::memory_order_relaxed);
+}
+
+float AudioMixer::Track::gain() const {
+    return static_cast<float>(gainQ14_.load(std::memory_order_relaxed)) / kernels::kUnityGain;
+}
+
+void AudioMixer::Track::push(const int16_t* data, size_t samplesPerChannel, int sampleRate, int channels) {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    push(data, samplesPerChannel, sampleRate, channels,
+         std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+}
+
+void AudioMixer::Track::push(const int16_t* data, size_t samplesPerChannel, int sampleRate, int channels,
+                             int64_t arrivalUs) {
+    if (!data || samplesPerChannel == 0 || sampleRate <= 0 || channels <= 0) {
+        return;
+    }
+
+    const int16_t* output = data;
+    size_t outputSamples = samplesPerChannel * static_cast<size_t>(channels);
+    if (sampleRate != outputRate_ || channels != outputChannels_) {
+        convert(data, samplesPerChannel, sampleRate, channels);
+        output = converted_.data();
+        outputSamples = converted_.size();
+    }
+
+    jitter_.push(output, outputSamples, arrivalUs);
+}
+
+void AudioMixer::Track::convert(const int16_t* data, size_t samplesPerChannel, int sampleRate, int channels) {
+    if (sampleRate != inputRate_ || channels != inputChannels_) {
+        inputRate_ = sampleRate;
+        inputChannels_ = channels;
+        step_ = static_cast<double>(sampleRate) / outputRate_;
+        phase_ = 0.0;
+        previous_.assign(static_cast<size_t>(outputChannels_), 0);
+    }
+
+    // Channel mapping: downmix to mono by averaging, otherwise repeat the
+    // last available input channel for extra outputs
+    const size_t outCh = static_cast<size_t>(outputChannels_);
+    mapped_.resize(samplesPerChannel * outCh);
+    for (size_t frame = 0; frame < samplesPerChannel; ++frame) {
+        const int16_t* in = data + frame * static_cast<size_t>(channels);
+        int16_t* out = mapped_.data() + frame * outCh;
+        if (outCh == 1) {
+            int32_t sum = 0;
+            for (int c = 0; c < channels; ++c) {
+                sum += in[c];
+            }
+            out[0] = static_cast<int16_t>(sum / channels);
+        } else {
+            for (size_t c = 0; c < outCh; ++c) {
+                out[c] = in[std::min<size_t>(c, static_cast<size_t>(channels) - 1)];
+            }
+        }
+    }
+
+    if (sampleRate == outputRate_) {
+        converted_.swap(mapped_);
+        return;
+    }
+
+    // Streaming linear interpolation; position 0 is the last frame of the
+    // previous chunk so chunk boundaries are seamless
+    const double inputFrames = static_cast<double>(samplesPerChannel);
+    converted_.clear();
+    converted_.reserve((static_cast<size_t>(inputFrames / step_) + 2) * outCh);
+    double position = phase_;
+    while (position < inputFrames) {
+        const size_t index = static_cast<size_t>(position);
+        const double frac = position - static_cast<double>(index);
+        const int16_t* a = index == 0 ? previous_.data() : mapped_.data() + (index - 1) * outCh;
+        const int16_t* b = mapped_.data() + index * outCh;
+        for (size_t c = 0; c < outCh; ++c) {
+            const double value = a[c] + (b[c] - a[c]) * frac;
+            converted_.push_back(static_cast<int16_t>(std::lround(value)));
+        }
+        position += step_;
+    }
+    phase_ = position - inputFrames;
+    std::copy(mapped_.end() - static_cast<std::ptrdiff_t>(outCh), mapped_.end(), previous_.begin());
+}
+
+AudioMixer::AudioMixer(int outputSampleRate, int outputChannels)
+    : outputRate_(outputSampleRate > 0 ? outputSampleRate : 48000),
+      outputChannels_(outputChannels > 0 ? outputChannels : 2) {
+    // Enough for the largest pull a sink is likely to make (100 ms)
+    const size_t reserve = samplesForMs(outputRate_, outputChannels_, 100);
+    accumulator_.reserve(reserve);
+    trackScratch_.reserve(reserve);
+}
+
+std::shared_ptr<AudioMixer::Track> AudioMixer::addTrack(const std::string& id) {
+    std::lock_guard<std::mutex> lock(tracksMutex_);
+    for (const auto& track : tracks_) {
+        if (track->id() == id) {
+            return track;
+        }
+    }
+    auto track = std::make_shared<Track>(id, outputRate_, outputChannels_);
+    tracks_.push_back(track);
+    return track;
+}
+
+void AudioMixer::removeTrack(const std::string& id) {
+    std::lock_guard<std::mutex> lock(tracksMutex_);
+    tracks_.erase(std::remove_if(tracks_.begin(), tracks_.end(),
+                                 [&id](const std::shared_ptr<Track>& track) { return track->id() == id; }),
+                  tracks_.end());
+}
+
+std::shared_ptr<AudioMixer::Track> AudioMixer::track(const std::string& id) const {
+    std::lock_guard<std::mutex> lock(tracksMutex_);
+    for (const auto& track : tracks_) {
+        if (track->id() == id) {
+            return track;
+        }
+    }
+    return nullptr;
+}
+
+size_t AudioMixer::trackCount() const {
+    std::lock_guard<std::mutex> lock(tracksMutex_);
+    return tracks_.size();
+}
+
+void AudioMixer::setTrackGain(const std::string& id, float gain) {
+    if (auto t = track(id)) {
+        t->setGain(gain);
+    }
+}
+
+void AudioMixer::setTrackMuted(const std::string& id, bool muted) {
+    if (auto t = track(id)) {
+        t->setMuted(muted);
+    }
+}
+
+void AudioMixer::mix(int16_t* out, size_t frames) {
+    const size_t needed = frames * static_cast<size_t>(outputChannels_);
+    if (needed == 0) {
+        return;
+    }
+    if (accumulator_.size() < needed) {
+        accumulator_.resize(needed);
+        trackScratch_.resize(needed);
+    }
+    std::fill(accumulator_.begin(), accumulator_.begin() + static_cast<std::ptrdiff_t>(needed), 0);
+
+    // Only the track list is copied under the lock, so control calls on
+    // other threads never hold up the device pull for a whole mix
+    {
+        std::lock_guard<std::mutex> lock(tracksMutex_);
+        mixTracks_.assign(tracks_.begin(), tracks_.end());
+    }
+    for (const auto& track : mixTracks_) {
+        // Muted tracks are still pulled so their playout clock keeps running
+        track->jitter_.pull(trackScratch_.data(), frames);
+
+        const int32_t gain = track->gainQ14_.load(std::memory_order_relaxed);
+        if (gain == 0 || track->isMuted()) {
+            continue;
+        }
+        kernels::accumulateScaled(trackScratch_.data(), accumulator_.data(), needed, gain);
+    }
+
+    kernels::saturateToInt16(accumulator_.data(), out, needed);
+}
+
+}  // namespace audio
+}  // namespace links
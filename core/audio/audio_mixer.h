@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Remote Track Mixer
+ */
+
+#ifndef AUDIO_AUDIO_MIXER_H_
+#define AUDIO_AUDIO_MIXER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "jitter_buffer.h"
+
+namespace links {
+namespace audio {
+
+// Mixes any number of remote audio tracks into a single interleaved int16
+// output stream.
+//
+// Each track has one producer at a time: its pushes may come from different
+// threads (the remote track executor runs them on any pool thread) but never
+// overlap, and each happens-after the previous one. That serialisation is
+// what the track's conversion state and adaptive JitterBuffer rely on; the
+// producer converts frames to the output rate and channel layout and queues
+// them there. The output side pulls with mix() on the
+// device clock, accumulating every track in 32-bit with its gain and
+// saturating once when converting back to int16.
+class AudioMixer {
+public:
+    class Track {
+    public:
+        Track(std::string id, int outputRate, int outputChannels);
+
+        Track(const Track&) = delete;
+        Track& operator=(const Track&) = delete;
+
+        const std::string& id() const { return id_; }
+
+        // Producer: queues one interleaved frame in any rate / channel layout.
+        // |arrivalUs| defaults to the steady clock at the time of the call.
+        void push(const int16_t* data, size_t samplesPerChannel, int sampleRate, int channels);
+        void push(const int16_t* data, size_t samplesPerChannel, int sampleRate, int channels,
+                  int64_t arrivalUs);
+
+        // Linear gain, [0, 2); may be called from any thread
+        void setGain(float gain);
+        float gain() const;
+
+        void setMuted(bool muted) { muted_.store(muted, std::memory_order_relaxed); }
+        bool isMuted() const { return muted_.load(std::memory_order_relaxed); }
+
+        // Playout latency and concealment statistics
+        JitterBufferStats stats() const { return jitter_.stats(); }
+        // Number of times the output ran dry while the track was playing
+        int64_t underruns() const { return jitter_.stats().underruns; }
+
+    private:
+        friend class AudioMixer;
+
+        void convert(const int16_t* data, size_t samplesPerChannel, int sampleRate, int channels);
+
+        const std::string id_;
+        const int outputRate_;
+        const int outputChannels_;
+
+        JitterBuffer jitter_;
+        std::atomic<int32_t> gainQ14_;
+        std::atomic<bool> muted_{false};
+
+        // Producer-side conversion state
+        int inputRate_ = 0;
+        int inputChannels_ = 0;
+        double step_ = 1.0;
+        double phase_ = 0.0;
+        std::vector<int16_t> previous_;
+        std::vector<int16_t> mapped_;
+        std::vector<int16_t> converted_;
+    };
+
+    AudioMixer(int outputSampleRate = 48000, int outputChannels = 2);
+
+    AudioMixer(const AudioMixer&) = delete;
+    AudioMixer& operator=(const AudioMixer&) = delete;
+
+    int outputSampleRate() const { return outputRate_; }
+    int outputChannels() const { return outputChannels_; }
+
+    // Registers a track and returns the handle its producer pushes into.
+    // Adding an existing id returns the existing track.
+    std::shared_ptr<Track> addTrack(const std::string& id);
+    void removeTrack(const std::string& id);
+    std::shared_ptr<Track> track(const std::string& id) const;
+    size_t trackCount() const;
+
+    void setTrackGain(const std::string& id, float gain);
+    void setTrackMuted(const std::string& id, bool muted);
+
+    // Consumer: writes |frames| interleaved output frames. Each track's
+    // jitter buffer supplies audio, concealment or silence.
+    void mix(int16_t* out, size_t frames);
+
+private:
+    const int outputRate_;
+    const int outputChannels_;
+
+    mutable std::mutex tracksMutex_;
+    std::vector<std::shared_ptr<Track>> tracks_;
+
+    // Mix scratch, owned by the consumer. mixTracks_ is the snapshot of
+    // tracks_ a mix works from; its capacity is kept between mixes.
+    std::vector<std::shared_ptr<Track>> mixTracks_;
+    std::vector<int32_t> accumulator_;
+    std::vector<int16_t> trackScratch_;
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_AUDIO_MIXER_H_
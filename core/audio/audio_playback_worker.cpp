@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Playback Worker
+ */
+
+#include "audio_playback_worker.h"
+
+#include "../../utils/logger.h"
+
+namespace links {
+namespace audio {
+
+AudioPlaybackWorker::AudioPlaybackWorker(QObject* parent)
+    : QObject(parent) {}
+
+AudioPlaybackWorker::~AudioPlaybackWorker() {
+    stop();
+}
+
+bool AudioPlaybackWorker::start(const QAudioDevice& device, const QAudioFormat& format,
+                                AudioMixer* mixer, int bufferMs, RenderReferenceTap* renderTap) {
+    stop();
+
+    // Created here so the sink, its timers and the pull device belong to this thread
+    mixerDevice_ = std::make_unique<MixerOutputDevice>(mixer);
+    mixerDevice_->open(QIODevice::ReadOnly);
+
+    audioSink_ = std::make_unique<QAudioSink>(device, format);
+    connect(audioSink_.get(), &QAudioSink::stateChanged,
+            this, &AudioPlaybackWorker::onStateChanged);
+    audioSink_->setBufferSize(format.bytesForDuration(static_cast<qint64>(bufferMs) * 1000));
+    if (renderTap) {
+        renderTap->configure(format.sampleRate(), format.channelCount());
+        mixerDevice_->setRenderTap(renderTap, audioSink_.get());
+    }
+    audioSink_->start(mixerDevice_.get());
+
+    if (audioSink_->error() != QAudio::NoError) {
+        Logger::instance().error(QString("Failed to start audio output (error %1)")
+                                     .arg(static_cast<int>(audioSink_->error())));
+        stop();
+        return false;
+    }
+    return true;
+}
+
+void AudioPlaybackWorker::stop() {
+    if (audioSink_) {
+        audioSink_->stop();
+        audioSink_.reset();
+    }
+    mixerDevice_.reset();
+}
+
+void AudioPlaybackWorker::onStateChanged(QAudio::State state) {
+    switch (state) {
+        case QAudio::ActiveState:
+            Logger::instance().debug("Audio output state: Active");
+            break;
+        case QAudio::SuspendedState:
+            Logger::instance().debug("Audio output state: Suspended");
+            break;
+        case QAudio::StoppedState:
+            if (audioSink_ && audioSink_->error() != QAudio::NoError) {
+                emit error(QString("Audio output stopped with error %1")
+                               .arg(static_cast<int>(audioSink_->error())));
+            }
+            Logger::instance().debug("Audio output state: Stopped");
+            break;
+        case QAudio::IdleState:
+            Logger::instance().debug("Audio output state: Idle");
+            break;
+    }
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Playback Worker
+ */
+
+#ifndef AUDIO_AUDIO_PLAYBACK_WORKER_H_
+#define AUDIO_AUDIO_PLAYBACK_WORKER_H_
+
+#include <QAudioDevice>
+#include <QAudioFormat>
+#include <QAudioSink>
+#include <QObject>
+#include <memory>
+#include "audio_mixer.h"
+#include "mixer_output_device.h"
+#include "render_reference_tap.h"
+
+namespace links {
+namespace audio {
+
+// Owns the single remote-audio QAudioSink and the pull device that feeds it
+// from AudioMixer. The worker lives on a dedicated audio thread (see
+// MediaPipeline), so the sink's pulls, mixing and jitter-buffer playout never
+// run on, or wait for, the GUI thread.
+//
+// start()/stop() must be called on the worker's thread.
+class AudioPlaybackWorker : public QObject {
+    Q_OBJECT
+
+public:
+    explicit AudioPlaybackWorker(QObject* parent = nullptr);
+    ~AudioPlaybackWorker() override;
+
+    // |renderTap| (optional) receives the mixed output as the AEC reference
+    bool start(const QAudioDevice& device, const QAudioFormat& format,
+               AudioMixer* mixer, int bufferMs, RenderReferenceTap* renderTap = nullptr);
+    void stop();
+    bool isActive() const { return audioSink_ != nullptr; }
+
+signals:
+    void error(const QString& message);
+
+private slots:
+    void onStateChanged(QAudio::State state);
+
+private:
+    std::unique_ptr<MixerOutputDevice> mixerDevice_;
+    std::unique_ptr<QAudioSink> audioSink_;
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_AUDIO_PLAYBACK_WORKER_H_
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Polyphase Resampler
+ */
+
+#include "audio_resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include "audio_kernels.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Kaiser beta 8 gives ~80 dB stopband; the transition band of a kBaseTaps
+// filter at that attenuation (Kaiser's estimate), as a fraction of the rate
+constexpr double kKaiserBeta = 8.0;
+constexpr double kStopbandDb = kKaiserBeta / 0.1102 + 8.7;
+const double kTransitionWidth = (kStopbandDb - 7.95) / (14.36 * PolyphaseResampler::kBaseTaps);
+
+// Zeroth-order modified Bessel function of the first kind (power series)
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    const double quarterSquare = x * x / 4.0;
+    for (int k = 1; k < 50; ++k) {
+        term *= quarterSquare / (static_cast<double>(k) * k);
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+double sinc(double x) {
+    return std::abs(x) < 1e-12 ? 1.0 : std::sin(kPi * x) / (kPi * x);
+}
+
+}  // namespace
+
+PolyphaseResampler::PolyphaseResampler(int inputRate, int outputRate, size_t maxInputFrames)
+    : inputRate_(std::max(1, inputRate)),
+      outputRate_(std::max(1, outputRate)) {
+    if (isPassthrough()) {
+        return;
+    }
+
+    const int divisor = std::gcd(inputRate_, outputRate_);
+    up_ = static_cast<size_t>(outputRate_ / divisor);
+    down_ = static_cast<size_t>(inputRate_ / divisor);
+    phases_ = std::min(up_, kMaxPhases);
+
+    // Downsampling lowers the cutoff, so the filter is lengthened by M/L to
+    // keep the same transition sharpness relative to the output rate
+    const size_t scaled = (kBaseTaps * down_ + up_ - 1) / up_;
+    taps_ = (std::max(kBaseTaps, scaled) + 7) / 8 * 8;
+
+    designFilter();
+    history_.resize(taps_ + maxInputFrames);
+    reset();
+}
+
+size_t PolyphaseResampler::maxOutputFrames(size_t inputFrames) const {
+    if (isPassthrough()) {
+        return inputFrames;
+    }
+    return (inputFrames + taps_) * up_ / down_ + 2;
+}
+
+void PolyphaseResampler::reset() {
+    if (isPassthrough()) {
+        return;
+    }
+    phase_ = 0;
+    position_ = 0;
+    // Leading zeros put the first output's filter centre on the first input sample
+    historySize_ = taps_ / 2 - 1;
+    std::fill(history_.begin(), history_.begin() + static_cast<std::ptrdiff_t>(historySize_), 0.0f);
+}
+
+size_t PolyphaseResampler::process(const float* in, size_t count, float* out) {
+    if (isPassthrough()) {
+        std::memcpy(out, in, count * sizeof(float));
+        return count;
+    }
+
+    if (historySize_ + count > history_.size()) {
+        history_.resize(historySize_ + count);
+    }
+    std::memcpy(history_.data() + historySize_, in, count * sizeof(float));
+    historySize_ += count;
+
+    size_t produced = 0;
+    while (position_ + taps_ <= historySize_) {
+        const size_t row = phases_ == up_ ? phase_ : phase_ * phases_ / up_;
+        out[produced++] = kernels::dotProduct(history_.data() + position_,
+                                              coefficients_.data() + row * taps_, taps_);
+        phase_ += down_;
+        position_ += phase_ / up_;
+        phase_ %= up_;
+    }
+
+    // Keep only what later outputs still need; when downsampling the next
+    // window may start beyond the data received so far
+    const size_t consumed = std::min(position_, historySize_);
+    std::memmove(history_.data(), history_.data() + consumed, (historySize_ - consumed) * sizeof(float));
+    historySize_ -= consumed;
+    position_ -= consumed;
+    return produced;
+}
+
+void PolyphaseResampler::designFilter() {
+    const double ratio = std::min(1.0, static_cast<double>(up_) / static_cast<double>(down_));
+    // Cutoff (cycles per input sample) places the stopband edge at the lower Nyquist rate
+    const double cutoff = ratio * (0.5 - kTransitionWidth / 2.0);
+    const double centre = static_cast<double>(taps_) / 2.0 - 1.0;
+    const double halfLength = static_cast<double>(taps_) / 2.0;
+    const double windowNorm = besselI0(kKaiserBeta);
+
+    coefficients_.assign(phases_ * taps_, 0.0f);
+    std::vector<double> row(taps_);
+    for (size_t p = 0; p < phases_; ++p) {
+        const double fraction = static_cast<double>(p) / static_cast<double>(phases_);
+        double sum = 0.0;
+        for (size_t k = 0; k < taps_; ++k) {
+            const double x = static_cast<double>(k) - centre - fraction;
+            const double r = x / halfLength;
+            const double window = std::abs(r) >= 1.0
+                ? 0.0
+                : besselI0(kKaiserBeta * std::sqrt(1.0 - r * r)) / windowNorm;
+            row[k] = 2.0 * cutoff * sinc(2.0 * cutoff * x) * window;
+            sum += row[k];
+        }
+        // Unity DC gain for every phase, so a constant input stays constant
+        for (size_t k = 0; k < taps_; ++k) {
+            coefficients_[p * taps_ + k] = static_cast<float>(row[k] / sum);
+        }
+    }
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Polyphase Resampler
+ */
+
+#ifndef AUDIO_AUDIO_RESAMPLER_H_
+#define AUDIO_AUDIO_RESAMPLER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace links {
+namespace audio {
+
+// Streaming mono sample-rate converter for rational ratios.
+//
+// The ratio is reduced to L/M (output/input). Each output sample is a dot
+// product of the input history with one phase of a Kaiser-windowed sinc
+// filter bank; the cutoff follows the lower of the two Nyquist rates, so the
+// same filter band-limits upsampling images and downsampling aliases. Up to
+// kMaxPhases phases are stored; ratios with a larger L use the nearest phase.
+//
+// Output is time-aligned with the input (no group delay beyond the filter's
+// half-length lookahead). Not thread-safe; all buffers are sized up front so
+// process() does not allocate for inputs up to |maxInputFrames|.
+class PolyphaseResampler {
+public:
+    PolyphaseResampler(int inputRate, int outputRate, size_t maxInputFrames = 4096);
+
+    PolyphaseResampler(const PolyphaseResampler&) = delete;
+    PolyphaseResampler& operator=(const PolyphaseResampler&) = delete;
+
+    int inputRate() const { return inputRate_; }
+    int outputRate() const { return outputRate_; }
+    bool isPassthrough() const { return inputRate_ == outputRate_; }
+    size_t tapsPerPhase() const { return taps_; }
+    size_t phaseCount() const { return phases_; }
+
+    // Upper bound on the output produced for |inputFrames| input samples
+    size_t maxOutputFrames(size_t inputFrames) const;
+
+    // Converts |count| input samples; |out| must hold maxOutputFrames(count).
+    // Returns the number of samples written.
+    size_t process(const float* in, size_t count, float* out);
+
+    // Drops the history (e.g. after a device restart)
+    void reset();
+
+    // Filter length at 1:1 and upsampling; downsampling widens it by M/L
+    static constexpr size_t kBaseTaps = 48;
+    static constexpr size_t kMaxPhases = 512;
+
+private:
+    void designFilter();
+
+    const int inputRate_;
+    const int outputRate_;
+    size_t up_ = 1;    // L
+    size_t down_ = 1;  // M
+    size_t taps_ = 0;
+    size_t phases_ = 0;
+
+    // phases_ rows of taps_ coefficients
+    std::vector<float> coefficients_;
+
+    // Unconsumed input, starting with the history the next output needs
+    std::vector<float> history_;
+    size_t historySize_ = 0;
+    size_t position_ = 0;  // start of the next output's window in history_
+    size_t phase_ = 0;     // numerator of its fractional offset, in [0, L)
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_AUDIO_RESAMPLER_H_
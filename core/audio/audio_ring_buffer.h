@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Lock-free Single-Producer/Single-Consumer Ring Buffer
+ */
+
+#ifndef AUDIO_AUDIO_RING_BUFFER_H_
+#define AUDIO_AUDIO_RING_BUFFER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace links {
+namespace audio {
+
+// Fixed-capacity ring buffer for trivially copyable samples.
+//
+// One thread may write and one (possibly different) thread may read without
+// locking. All storage is allocated in the constructor; write/read/peek never
+// allocate, which keeps the real-time capture path allocation-free.
+template <typename T>
+class SpscRingBuffer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SpscRingBuffer requires trivially copyable samples");
+
+public:
+    // A readable or writable region split at the physical end of the buffer
+    struct Span {
+        T* first = nullptr;
+        size_t firstSize = 0;
+        T* second = nullptr;
+        size_t secondSize = 0;
+
+        size_t size() const { return firstSize + secondSize; }
+    };
+
+    // Capacity is rounded up to the next power of two
+    explicit SpscRingBuffer(size_t minCapacity)
+        : capacity_(roundUpPowerOfTwo(std::max<size_t>(minCapacity, 2))),
+          mask_(capacity_ - 1),
+          data_(new T[capacity_]()) {}
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    size_t capacity() const { return capacity_; }
+
+    // Number of samples ready to be read (consumer side)
+    size_t available() const {
+        return writePos_.load(std::memory_order_acquire) - readPos_.load(std::memory_order_relaxed);
+    }
+
+    // Number of samples that can be written (producer side)
+    size_t freeSpace() const {
+        return capacity_ - (writePos_.load(std::memory_order_relaxed)
+                            - readPos_.load(std::memory_order_acquire));
+    }
+
+    // Copies up to |count| samples in; returns how many were accepted
+    size_t write(const T* src, size_t count) {
+        Span span = writableSpan(count);
+        std::memcpy(span.first, src, span.firstSize * sizeof(T));
+        if (span.secondSize > 0) {
+            std::memcpy(span.second, src + span.firstSize, span.secondSize * sizeof(T));
+        }
+        commitWrite(span.size());
+        return span.size();
+    }
+
+    // Copies up to |count| samples out; returns how many were read
+    size_t read(T* dst, size_t count) {
+        Span span = readableSpan(count);
+        std::memcpy(dst, span.first, span.firstSize * sizeof(T));
+        if (span.secondSize > 0) {
+            std::memcpy(dst + span.firstSize, span.second, span.secondSize * sizeof(T));
+        }
+        consume(span.size());
+        return span.size();
+    }
+
+    // Returns a pointer to |count| contiguous readable samples. When the
+    // region wraps, the samples are copied into |scratch| (which must hold
+    // |count| samples). Returns nullptr if fewer than |count| are buffered.
+    // Call consume(count) once the data has been used.
+    const T* contiguousRead(size_t count, T* scratch) const {
+        Span span = readableSpan(count);
+        if (span.size() < count) {
+            return nullptr;
+        }
+        if (span.secondSize == 0) {
+            return span.first;
+        }
+        std::memcpy(scratch, span.first, span.firstSize * sizeof(T));
+        std::memcpy(scratch + span.firstSize, span.second, span.secondSize * sizeof(T));
+        return scratch;
+    }
+
+    // Producer: region that can be filled in place, followed by commitWrite()
+    Span writableSpan(size_t maxCount) const {
+        const size_t write = writePos_.load(std::memory_order_relaxed);
+        const size_t count = std::min(maxCount, freeSpace());
+        return makeSpan(write, count);
+    }
+
+    void commitWrite(size_t count) {
+        writePos_.store(writePos_.load(std::memory_order_relaxed) + count,
+                        std::memory_order_release);
+    }
+
+    // Consumer: region that can be read in place, followed by consume()
+    Span readableSpan(size_t maxCount) const {
+        const size_t read = readPos_.load(std::memory_order_relaxed);
+        const size_t count = std::min(maxCount, available());
+        return makeSpan(read, count);
+    }
+
+    void consume(size_t count) {
+        readPos_.store(readPos_.load(std::memory_order_relaxed) + count,
+                       std::memory_order_release);
+    }
+
+    // Consumer: drops everything currently buffered
+    void clear() {
+        readPos_.store(writePos_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    static size_t roundUpPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    Span makeSpan(size_t position, size_t count) const {
+        const size_t offset = position & mask_;
+        const size_t firstSize = std::min(count, capacity_ - offset);
+        Span span;
+        span.first = data_.get() + offset;
+        span.firstSize = firstSize;
+        span.second = data_.get();
+        span.secondSize = count - firstSize;
+        return span;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<T[]> data_;
+
+    // Monotonic positions; kept on separate cache lines to avoid false sharing
+    alignas(64) std::atomic<size_t> writePos_{0};
+    alignas(64) std::atomic<size_t> readPos_{0};
+};
+
+using AudioRingBuffer = SpscRingBuffer<int16_t>;
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_AUDIO_RING_BUFFER_H_
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Capture Format Converter
+ */
+
+#include "capture_converter.h"
+
+#include <algorithm>
+#include <cstring>
+#include "audio_kernels.h"
+
+namespace links {
+namespace audio {
+
+size_t bytesPerSample(SampleFormat format) {
+    switch (format) {
+        case SampleFormat::UInt8:
+            return 1;
+        case SampleFormat::Int16:
+            return 2;
+        case SampleFormat::Int32:
+        case SampleFormat::Float:
+            return 4;
+    }
+    return 2;
+}
+
+bool CaptureConverter::configure(int inputRate, int inputChannels, SampleFormat format,
+                                 size_t maxInputFrames) {
+    if (inputRate <= 0 || inputChannels <= 0 || maxInputFrames == 0) {
+        return false;
+    }
+
+    inputRate_ = inputRate;
+    inputChannels_ = inputChannels;
+    format_ = format;
+    bytesPerFrame_ = bytesPerSample(format) * static_cast<size_t>(inputChannels);
+    maxInputFrames_ = maxInputFrames;
+    passthrough_ = inputRate == kOutputRate && inputChannels == 1 && format == SampleFormat::Int16;
+
+    resampler_ = std::make_unique<PolyphaseResampler>(inputRate, kOutputRate, maxInputFrames);
+    interleaved_.assign(maxInputFrames * static_cast<size_t>(inputChannels), 0.0f);
+    resampled_.assign(resampler_->maxOutputFrames(maxInputFrames), 0.0f);
+    return true;
+}
+
+size_t CaptureConverter::maxOutputFrames(size_t inputFrames) const {
+    return resampler_ ? resampler_->maxOutputFrames(inputFrames) : inputFrames;
+}
+
+size_t CaptureConverter::process(const void* data, size_t frames, int16_t* out) {
+    if (frames == 0) {
+        return 0;
+    }
+    if (passthrough_ || !resampler_) {
+        std::memcpy(out, data, frames * sizeof(int16_t));
+        return frames;
+    }
+
+    frames = std::min(frames, maxInputFrames_);
+    const size_t samples = frames * static_cast<size_t>(inputChannels_);
+    toFloat(data, samples, interleaved_.data());
+
+    // Downmix in place: the mono result occupies the front of the buffer
+    kernels::downmixToMono(interleaved_.data(), interleaved_.data(), frames, inputChannels_);
+
+    const size_t produced = resampler_->process(interleaved_.data(), frames, resampled_.data());
+    kernels::floatToInt16(resampled_.data(), out, produced);
+    return produced;
+}
+
+void CaptureConverter::reset() {
+    if (resampler_) {
+        resampler_->reset();
+    }
+}
+
+void CaptureConverter::toFloat(const void* data, size_t samples, float* out) const {
+    switch (format_) {
+        case SampleFormat::Int16:
+            kernels::int16ToFloat(static_cast<const int16_t*>(data), out, samples);
+            break;
+        case SampleFormat::Float:
+            // Device floats are +-1.0 full scale
+            kernels::scaleFloat(static_cast<const float*>(data), out, samples, 32768.0f);
+            break;
+        case SampleFormat::Int32: {
+            const int32_t* in = static_cast<const int32_t*>(data);
+            for (size_t i = 0; i < samples; ++i) {
+                out[i] = static_cast<float>(in[i]) * (1.0f / 65536.0f);
+            }
+            break;
+        }
+        case SampleFormat::UInt8: {
+            const uint8_t* in = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < samples; ++i) {
+                out[i] = (static_cast<float>(in[i]) - 128.0f) * 256.0f;
+            }
+            break;
+        }
+    }
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Capture Format Converter
+ */
+
+#ifndef AUDIO_CAPTURE_CONVERTER_H_
+#define AUDIO_CAPTURE_CONVERTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "audio_resampler.h"
+
+namespace links {
+namespace audio {
+
+// Device sample formats (mirrors QAudioFormat::SampleFormat)
+enum class SampleFormat {
+    UInt8,
+    Int16,
+    Int32,
+    Float
+};
+
+size_t bytesPerSample(SampleFormat format);
+
+// Turns raw microphone data in the device's native rate, channel count and
+// sample format into mono int16 at the processing rate (48 kHz) that APM and
+// LiveKit expect: format -> float, downmix, polyphase resample, int16.
+//
+// 48 kHz mono Int16 input is passed through untouched. Not thread-safe; it is
+// owned by the capture thread and does not allocate after configure() for
+// chunks up to |maxInputFrames|.
+class CaptureConverter {
+public:
+    static constexpr int kOutputRate = 48000;
+
+    CaptureConverter() = default;
+
+    CaptureConverter(const CaptureConverter&) = delete;
+    CaptureConverter& operator=(const CaptureConverter&) = delete;
+
+    bool configure(int inputRate, int inputChannels, SampleFormat format, size_t maxInputFrames = 4096);
+
+    bool isPassthrough() const { return passthrough_; }
+    size_t bytesPerFrame() const { return bytesPerFrame_; }
+    size_t maxInputFrames() const { return maxInputFrames_; }
+
+    // Upper bound on the output produced for |inputFrames| device frames
+    size_t maxOutputFrames(size_t inputFrames) const;
+
+    // Converts |frames| interleaved device frames (frames <= maxInputFrames());
+    // |out| must hold maxOutputFrames(frames). Returns the samples written.
+    size_t process(const void* data, size_t frames, int16_t* out);
+
+    void reset();
+
+private:
+    void toFloat(const void* data, size_t samples, float* out) const;
+
+    int inputRate_ = kOutputRate;
+    int inputChannels_ = 1;
+    SampleFormat format_ = SampleFormat::Int16;
+    size_t bytesPerFrame_ = sizeof(int16_t);
+    size_t maxInputFrames_ = 0;
+    bool passthrough_ = true;
+
+    std::unique_ptr<PolyphaseResampler> resampler_;
+    std::vector<float> interleaved_;
+    std::vector<float> resampled_;
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_CAPTURE_CONVERTER_H_
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Capture Timing Statistics
+ */
+
+#include "capture_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace links {
+namespace audio {
+
+CaptureStats::CaptureStats(int sampleRate) {
+    reset(sampleRate);
+}
+
+void CaptureStats::reset(int sampleRate) {
+    sampleRate_ = sampleRate > 0 ? sampleRate : 48000;
+    lastCallbackUs_ = -1;
+    totalIntervalUs_ = 0;
+    maxIntervalUs_ = 0;
+    jitterUs_ = 0.0;
+    totalProcessingUs_ = 0;
+    counters_ = CaptureStatsSnapshot();
+}
+
+void CaptureStats::onDeviceData(int64_t nowUs, size_t framesDelivered) {
+    ++counters_.callbacks;
+    if (lastCallbackUs_ >= 0) {
+        const int64_t intervalUs = nowUs - lastCallbackUs_;
+        totalIntervalUs_ += intervalUs;
+        maxIntervalUs_ = std::max(maxIntervalUs_, intervalUs);
+
+        // The data delivered now covers the time since the previous callback
+        // when the device is steady; any difference is scheduling jitter.
+        const double audioUs = static_cast<double>(framesDelivered) * 1e6 / sampleRate_;
+        const double deviation = std::fabs(static_cast<double>(intervalUs) - audioUs);
+        jitterUs_ += (deviation - jitterUs_) / 16.0;
+    }
+    lastCallbackUs_ = nowUs;
+}
+
+void CaptureStats::onFrameProcessed(int64_t processingUs, int64_t budgetUs) {
+    ++counters_.framesProcessed;
+    totalProcessingUs_ += processingUs;
+    counters_.maxProcessingUs = std::max(counters_.maxProcessingUs,
+                                         static_cast<double>(processingUs));
+    if (processingUs > budgetUs) {
+        ++counters_.framesOverBudget;
+    }
+}
+
+void CaptureStats::onOverrun(size_t droppedSamples) {
+    ++counters_.overruns;
+    counters_.droppedSamples += static_cast<int64_t>(droppedSamples);
+}
+
+CaptureStatsSnapshot CaptureStats::snapshot() const {
+    CaptureStatsSnapshot result = counters_;
+    if (counters_.callbacks > 1) {
+        result.meanCallbackIntervalMs =
+            static_cast<double>(totalIntervalUs_) / (counters_.callbacks - 1) / 1000.0;
+    }
+    result.maxCallbackIntervalMs = static_cast<double>(maxIntervalUs_) / 1000.0;
+    result.jitterMs = jitterUs_ / 1000.0;
+    if (counters_.framesProcessed > 0) {
+        result.meanProcessingUs =
+            static_cast<double>(totalProcessingUs_) / counters_.framesProcessed;
+    }
+    return result;
+}
+
+}  // namespace audio
+}  // namespace links
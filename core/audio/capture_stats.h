@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Capture Timing Statistics
+ */
+
+#ifndef AUDIO_CAPTURE_STATS_H_
+#define AUDIO_CAPTURE_STATS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace links {
+namespace audio {
+
+struct CaptureStatsSnapshot {
+    // Device callbacks (readyRead) and the spacing between them
+    int64_t callbacks = 0;
+    double meanCallbackIntervalMs = 0.0;
+    double maxCallbackIntervalMs = 0.0;
+
+    // Interarrival jitter (RFC 3550 estimator): deviation between the wall
+    // clock time between callbacks and the audio duration they delivered
+    double jitterMs = 0.0;
+
+    // Per 10 ms frame APM + captureFrame cost
+    int64_t framesProcessed = 0;
+    double meanProcessingUs = 0.0;
+    double maxProcessingUs = 0.0;
+    int64_t framesOverBudget = 0;
+
+    // Ring buffer overruns (device data discarded because the consumer lagged)
+    int64_t overruns = 0;
+    int64_t droppedSamples = 0;
+};
+
+// Accumulates timing statistics for one capture session.
+//
+// Not thread-safe: it is updated only by the capture thread. Other threads
+// read the copies the capture thread publishes.
+class CaptureStats {
+public:
+    explicit CaptureStats(int sampleRate = 48000);
+
+    void reset(int sampleRate);
+
+    // Called once per device callback with the frames (samples per channel) read
+    void onDeviceData(int64_t nowUs, size_t framesDelivered);
+
+    // Called once per processed 10 ms frame
+    void onFrameProcessed(int64_t processingUs, int64_t budgetUs);
+
+    // Called when device data had to be discarded
+    void onOverrun(size_t droppedSamples);
+
+    CaptureStatsSnapshot snapshot() const;
+
+private:
+    int sampleRate_;
+    int64_t lastCallbackUs_ = -1;
+    int64_t totalIntervalUs_ = 0;
+    int64_t maxIntervalUs_ = 0;
+    double jitterUs_ = 0.0;
+    int64_t totalProcessingUs_ = 0;
+    CaptureStatsSnapshot counters_;
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_CAPTURE_STATS_H_
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Adaptive Jitter Buffer
+ */
+
+#include "jitter_buffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace links {
+namespace audio {
+
+namespace {
+
+constexpr int kCapacityMs = 500;
+constexpr int kCrossfadeUs = 2500;
+constexpr int kAdjustMs = 10;
+constexpr int kHysteresisMs = 15;
+// Minimum output between two accelerate/expand operations
+constexpr int kAdjustIntervalMs = 50;
+// Histogram forgetting factor per pushed frame (~3.5 s half-life at 100 fps)
+constexpr double kForgetFactor = 0.998;
+constexpr double kLatenessPercentile = 0.95;
+// The lateness anchor rises 1 ms per second to forget early outliers and
+// absorb sender/receiver clock drift
+constexpr double kAnchorDriftPerUs = 0.001;
+// Media time counts pushed samples, so audio lost upstream (network, SFU or
+// executor drops) moves every later offset up by the gap. Frames that all
+// stay this late for this long are taken as such a step and re-anchored;
+// real jitter always lets some frames through on time.
+constexpr double kReanchorThresholdUs = 40000.0;
+constexpr int64_t kReanchorHoldUs = 1000000;
+constexpr double kLevelSmoothing = 0.1;
+constexpr float kConcealDecayPerBlock = 0.5f;
+constexpr float kConcealSilenceGain = 0.05f;
+
+inline int16_t blend(int16_t from, int16_t to, float weight) {
+    return static_cast<int16_t>(std::lround(from + (to - from) * weight));
+}
+
+}  // namespace
+
+JitterBuffer::JitterBuffer(int sampleRate, int channels)
+    : sampleRate_(sampleRate > 0 ? sampleRate : 48000),
+      channels_(channels > 0 ? channels : 1),
+      crossfadeSamples_(static_cast<size_t>(sampleRate_) * kCrossfadeUs / 1000000 * channels_),
+      adjustSamples_(samplesForMs(kAdjustMs)),
+      hysteresisSamples_(samplesForMs(kHysteresisMs)),
+      ring_(samplesForMs(kCapacityMs)),
+      targetSamples_(samplesForMs(kMinTargetMs)),
+      history_(samplesForMs(kAdjustMs), 0),
+      scratchA_(samplesForMs(kAdjustMs) + crossfadeSamples_),
+      scratchB_(crossfadeSamples_),
+      pending_(samplesForMs(kAdjustMs) + crossfadeSamples_) {
+    filteredLevel_ = static_cast<double>(targetSamples_.load());
+}
+
+void JitterBuffer::push(const int16_t* samples, size_t count, int64_t arrivalUs) {
+    if (!samples || count == 0) {
+        return;
+    }
+    updateTarget(arrivalUs, count);
+
+    const size_t written = ring_.write(samples, count);
+    if (written < count) {
+        overflowDropped_.fetch_add(static_cast<int64_t>(count - written), std::memory_order_relaxed);
+    }
+}
+
+void JitterBuffer::updateTarget(int64_t arrivalUs, size_t count) {
+    const int64_t frames = static_cast<int64_t>(count / static_cast<size_t>(channels_));
+    mediaUs_ += frames * 1000000 / sampleRate_;
+
+    // Offset between arrival and media time; its minimum is the "on time" anchor
+    const double offset = static_cast<double>(arrivalUs - mediaUs_);
+    if (!haveArrival_) {
+        haveArrival_ = true;
+        anchorUs_ = offset;
+    } else {
+        jitterUs_ += (std::fabs(offset - lastOffsetUs_) - jitterUs_) / 16.0;
+        anchorUs_ += static_cast<double>(arrivalUs - lastArrivalUs_) * kAnchorDriftPerUs;
+    }
+    lastArrivalUs_ = arrivalUs;
+    lastOffsetUs_ = offset;
+    anchorUs_ = std::min(anchorUs_, offset);
+
+    if (offset - anchorUs_ > kReanchorThresholdUs) {
+        if (!shiftPending_) {
+            shiftPending_ = true;
+            shiftStartUs_ = arrivalUs;
+            shiftMinOffsetUs_ = offset;
+            histogramBeforeShift_ = histogram_;
+        }
+        shiftMinOffsetUs_ = std::min(shiftMinOffsetUs_, offset);
+        if (arrivalUs - shiftStartUs_ >= kReanchorHoldUs) {
+            // The frames since the step were not late, the anchor was wrong;
+            // their lateness is taken back out of the histogram
+            anchorUs_ = shiftMinOffsetUs_;
+            histogram_ = histogramBeforeShift_;
+            shiftPending_ = false;
+        }
+    } else {
+        shiftPending_ = false;
+    }
+
+    const double latenessMs = (offset - anchorUs_) / 1000.0;
+    const size_t bucket = std::min(kBuckets - 1, static_cast<size_t>(latenessMs / kBucketMs));
+    double total = 0.0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        histogram_[i] *= kForgetFactor;
+        total += histogram_[i];
+    }
+    histogram_[bucket] += 1.0 - kForgetFactor;
+    total += 1.0 - kForgetFactor;
+
+    double cumulative = 0.0;
+    size_t percentileBucket = kBuckets - 1;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        cumulative += histogram_[i];
+        if (cumulative >= kLatenessPercentile * total) {
+            percentileBucket = i;
+            break;
+        }
+    }
+
+    // Cover the late tail plus one frame of scheduling slack
+    const int targetMs = std::clamp(static_cast<int>((percentileBucket + 1) * kBucketMs) + kAdjustMs,
+                                    kMinTargetMs, kMaxTargetMs);
+    targetSamples_.store(samplesForMs(targetMs), std::memory_order_relaxed);
+    jitterUsStat_.store(static_cast<int64_t>(jitterUs_), std::memory_order_relaxed);
+}
+
+size_t JitterBuffer::pull(int16_t* out, size_t frames) {
+    const size_t need = frames * static_cast<size_t>(channels_);
+    if (need == 0) {
+        return 0;
+    }
+
+    const size_t target = targetSamples_.load(std::memory_order_relaxed);
+    const size_t level = ring_.available() + pendingSize_;
+
+    if (!playing_) {
+        if (level < std::max(target, need)) {
+            conceal(out, need);
+            return 0;
+        }
+        playing_ = true;
+        playedBefore_ = true;
+        filteredLevel_ = static_cast<double>(level);
+        samplesSinceAdjust_ = 0;
+    }
+    filteredLevel_ += (static_cast<double>(level) - filteredLevel_) * kLevelSmoothing;
+    levelStat_.store(static_cast<int64_t>(filteredLevel_), std::memory_order_relaxed);
+
+    size_t written = drainPending(out, need);
+    if (written < need && samplesSinceAdjust_ >= samplesForMs(kAdjustIntervalMs)
+        && ring_.available() >= adjustSamples_ + crossfadeSamples_) {
+        if (filteredLevel_ > static_cast<double>(target + hysteresisSamples_)) {
+            accelerate();
+        } else if (filteredLevel_ + static_cast<double>(hysteresisSamples_) < static_cast<double>(target)) {
+            expand();
+        }
+        written += drainPending(out + written, need - written);
+    }
+
+    written += ring_.read(out + written, need - written);
+    samplesSinceAdjust_ += need;
+
+    if (written < need) {
+        // Ran dry: conceal the gap and re-prime at the (possibly raised) target
+        underruns_.fetch_add(1, std::memory_order_relaxed);
+        playing_ = false;
+        remember(out, written);
+        conceal(out + written, need - written);
+    } else {
+        concealGain_ = 1.0f;
+        remember(out, need);
+    }
+    return written / static_cast<size_t>(channels_);
+}
+
+size_t JitterBuffer::drainPending(int16_t* out, size_t samples) {
+    const size_t count = std::min(samples, pendingSize_ - pendingPos_);
+    std::memcpy(out, pending_.data() + pendingPos_, count * sizeof(int16_t));
+    pendingPos_ += count;
+    if (pendingPos_ == pendingSize_) {
+        pendingPos_ = 0;
+        pendingSize_ = 0;
+    }
+    return count;
+}
+
+void JitterBuffer::accelerate() {
+    // Crossfade from the current position into audio |adjustSamples_| later,
+    // removing that much latency: A = [p, p + xf), B = [p + adjust, p + adjust + xf)
+    const size_t xf = crossfadeSamples_;
+    ring_.read(scratchA_.data(), xf);
+    ring_.consume(adjustSamples_ - xf);
+    ring_.read(scratchB_.data(), xf);
+
+    const size_t ch = static_cast<size_t>(channels_);
+    const size_t xfFrames = xf / ch;
+    for (size_t frame = 0; frame < xfFrames; ++frame) {
+        const float weight = (static_cast<float>(frame) + 0.5f) / static_cast<float>(xfFrames);
+        for (size_t c = 0; c < ch; ++c) {
+            const size_t i = frame * ch + c;
+            pending_[i] = blend(scratchA_[i], scratchB_[i], weight);
+        }
+    }
+    pendingPos_ = 0;
+    pendingSize_ = xf;
+    accelerated_.fetch_add(static_cast<int64_t>(adjustSamples_), std::memory_order_relaxed);
+    samplesSinceAdjust_ = 0;
+}
+
+void JitterBuffer::expand() {
+    // Play the next segment S = [p, p + adjust + xf) but crossfade its tail
+    // back into its own start and only consume xf, repeating |adjustSamples_|
+    const size_t xf = crossfadeSamples_;
+    const size_t length = adjustSamples_ + xf;
+    const int16_t* segment = ring_.contiguousRead(length, scratchA_.data());
+    if (!segment) {
+        return;
+    }
+
+    std::memcpy(pending_.data(), segment, adjustSamples_ * sizeof(int16_t));
+    const size_t ch = static_cast<size_t>(channels_);
+    const size_t xfFrames = xf / ch;
+    for (size_t frame = 0; frame < xfFrames; ++frame) {
+        const float weight = (static_cast<float>(frame) + 0.5f) / static_cast<float>(xfFrames);
+        for (size_t c = 0; c < ch; ++c) {
+            const size_t i = frame * ch + c;
+            pending_[adjustSamples_ + i] = blend(segment[adjustSamples_ + i], segment[i], weight);
+        }
+    }
+    ring_.consume(xf);
+    pendingPos_ = 0;
+    pendingSize_ = length;
+    expanded_.fetch_add(static_cast<int64_t>(adjustSamples_), std::memory_order_relaxed);
+    samplesSinceAdjust_ = 0;
+}
+
+void JitterBuffer::conceal(int16_t* out, size_t samples) {
+    if (!playedBefore_ || concealGain_ <= 0.0f) {
+        std::memset(out, 0, samples * sizeof(int16_t));
+        return;
+    }
+
+    // Loop the last played 10 ms with a gain that ramps down across the gap
+    const size_t ch = static_cast<size_t>(channels_);
+    const size_t frames = samples / ch;
+    const float startGain = concealGain_;
+    float endGain = startGain * std::pow(kConcealDecayPerBlock,
+                                         static_cast<float>(samples) / static_cast<float>(history_.size()));
+    if (endGain < kConcealSilenceGain) {
+        endGain = 0.0f;
+    }
+    for (size_t frame = 0; frame < frames; ++frame) {
+        const float gain = startGain + (endGain - startGain) * (static_cast<float>(frame) + 1.0f) / frames;
+        for (size_t c = 0; c < ch; ++c) {
+            out[frame * ch + c] = static_cast<int16_t>(std::lround(history_[historyPos_ + c] * gain));
+        }
+        historyPos_ = (historyPos_ + ch) % history_.size();
+    }
+    concealGain_ = endGain;
+    concealed_.fetch_add(static_cast<int64_t>(samples), std::memory_order_relaxed);
+}
+
+void JitterBuffer::remember(const int16_t* out, size_t samples) {
+    const size_t size = history_.size();
+    if (samples >= size) {
+        std::memcpy(history_.data(), out + samples - size, size * sizeof(int16_t));
+    } else if (samples > 0) {
+        std::memmove(history_.data(), history_.data() + samples, (size - samples) * sizeof(int16_t));
+        std::memcpy(history_.data() + size - samples, out, samples * sizeof(int16_t));
+    }
+    historyPos_ = 0;
+}
+
+size_t JitterBuffer::samplesForMs(int ms) const {
+    return static_cast<size_t>(sampleRate_) * static_cast<size_t>(ms) / 1000 * static_cast<size_t>(channels_);
+}
+
+double JitterBuffer::samplesToMs(double samples) const {
+    return samples * 1000.0 / (static_cast<double>(sampleRate_) * channels_);
+}
+
+JitterBufferStats JitterBuffer::stats() const {
+    JitterBufferStats stats;
+    stats.targetDelayMs = samplesToMs(static_cast<double>(targetSamples_.load(std::memory_order_relaxed)));
+    stats.currentDelayMs = samplesToMs(static_cast<double>(levelStat_.load(std::memory_order_relaxed)));
+    stats.jitterMs = static_cast<double>(jitterUsStat_.load(std::memory_order_relaxed)) / 1000.0;
+    stats.underruns = underruns_.load(std::memory_order_relaxed);
+    stats.concealedMs = samplesToMs(static_cast<double>(concealed_.load(std::memory_order_relaxed)));
+    stats.acceleratedMs = samplesToMs(static_cast<double>(accelerated_.load(std::memory_order_relaxed)));
+    stats.expandedMs = samplesToMs(static_cast<double>(expanded_.load(std::memory_order_relaxed)));
+    stats.overflowDroppedMs =
+        samplesToMs(static_cast<double>(overflowDropped_.load(std::memory_order_relaxed)));
+    return stats;
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Adaptive Jitter Buffer
+ */
+
+#ifndef AUDIO_JITTER_BUFFER_H_
+#define AUDIO_JITTER_BUFFER_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "audio_ring_buffer.h"
+
+namespace links {
+namespace audio {
+
+struct JitterBufferStats {
+    double targetDelayMs = 0.0;     // adaptive playout delay
+    double currentDelayMs = 0.0;    // smoothed buffer level seen by the playout clock
+    double jitterMs = 0.0;          // RFC 3550 interarrival jitter
+    int64_t underruns = 0;
+    double concealedMs = 0.0;       // audio synthesized while the buffer was empty
+    double acceleratedMs = 0.0;     // audio removed to shrink latency
+    double expandedMs = 0.0;        // audio inserted to grow the cushion
+    double overflowDroppedMs = 0.0; // audio dropped because the buffer was full
+};
+
+// Per-track playout buffer for remote audio.
+//
+// The producer (stream reader) pushes frames as they arrive and the estimator
+// tracks how late frames arrive relative to their media time. The target delay
+// follows the 95th percentile of that lateness. The consumer pulls on the
+// output device clock; when the buffered level drifts away from the target it
+// drops or repeats short crossfaded segments, and an empty buffer is concealed
+// by fading out the last played audio instead of clicking to silence.
+//
+// push() calls must be serialised (one after another, possibly on different
+// threads, as the track executor runs them), and so must pull() calls;
+// stats() may be called from anywhere.
+class JitterBuffer {
+public:
+    JitterBuffer(int sampleRate, int channels);
+
+    JitterBuffer(const JitterBuffer&) = delete;
+    JitterBuffer& operator=(const JitterBuffer&) = delete;
+
+    // Producer: queues interleaved samples that arrived at |arrivalUs|
+    // (any monotonic clock in microseconds)
+    void push(const int16_t* samples, size_t count, int64_t arrivalUs);
+
+    // Consumer: always writes |frames| interleaved frames (audio, concealment
+    // or silence). Returns the number of frames that carried received audio.
+    size_t pull(int16_t* out, size_t frames);
+
+    bool isPlaying() const { return playing_; }
+    JitterBufferStats stats() const;
+
+    static constexpr int kMinTargetMs = 20;
+    static constexpr int kMaxTargetMs = 250;
+
+private:
+    void updateTarget(int64_t arrivalUs, size_t count);
+    void accelerate();
+    void expand();
+    size_t drainPending(int16_t* out, size_t samples);
+    void conceal(int16_t* out, size_t samples);
+    void remember(const int16_t* out, size_t samples);
+    size_t samplesForMs(int ms) const;
+    double samplesToMs(double samples) const;
+
+    // Lateness histogram: 2 ms buckets with exponential forgetting
+    static constexpr int kBucketMs = 2;
+    static constexpr size_t kBuckets = kMaxTargetMs / kBucketMs + 1;
+
+    const int sampleRate_;
+    const int channels_;
+    const size_t crossfadeSamples_;
+    const size_t adjustSamples_;
+    const size_t hysteresisSamples_;
+
+    AudioRingBuffer ring_;
+    std::atomic<size_t> targetSamples_;
+
+    // Producer-side estimator state
+    bool haveArrival_ = false;
+    int64_t mediaUs_ = 0;
+    int64_t lastArrivalUs_ = 0;
+    double lastOffsetUs_ = 0.0;
+    double anchorUs_ = 0.0;
+    std::array<double, kBuckets> histogram_{};
+    // A step in the offset that has lasted since shiftStartUs_ (see
+    // updateTarget), with the histogram as it was before the step
+    bool shiftPending_ = false;
+    int64_t shiftStartUs_ = 0;
+    double shiftMinOffsetUs_ = 0.0;
+    std::array<double, kBuckets> histogramBeforeShift_{};
+    double jitterUs_ = 0.0;
+
+    // Consumer-side playout state
+    bool playing_ = false;
+    bool playedBefore_ = false;
+    double filteredLevel_ = 0.0;
+    size_t samplesSinceAdjust_ = 0;
+    std::vector<int16_t> history_;
+    size_t historyPos_ = 0;
+    float concealGain_ = 0.0f;
+    std::vector<int16_t> scratchA_;
+    std::vector<int16_t> scratchB_;
+    // Crossfaded output of the last accelerate/expand, played before the ring
+    std::vector<int16_t> pending_;
+    size_t pendingPos_ = 0;
+    size_t pendingSize_ = 0;
+
+    // Statistics (samples unless noted)
+    std::atomic<int64_t> jitterUsStat_{0};
+    std::atomic<int64_t> levelStat_{0};
+    std::atomic<int64_t> underruns_{0};
+    std::atomic<int64_t> concealed_{0};
+    std::atomic<int64_t> accelerated_{0};
+    std::atomic<int64_t> expanded_{0};
+    std::atomic<int64_t> overflowDropped_{0};
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_JITTER_BUFFER_H_
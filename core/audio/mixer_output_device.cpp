@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Pull-mode QIODevice over AudioMixer
+ */
+
+#include "mixer_output_device.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace links {
+namespace audio {
+
+MixerOutputDevice::MixerOutputDevice(AudioMixer* mixer, QObject* parent)
+    : QIODevice(parent),
+      mixer_(mixer),
+      bytesPerFrame_(static_cast<qint64>(sizeof(int16_t)) * mixer->outputChannels()) {}
+
+void MixerOutputDevice::setRenderTap(RenderReferenceTap* tap, const QAudioSink* sink) {
+    renderTap_ = tap;
+    sink_ = sink;
+}
+
+qint64 MixerOutputDevice::bytesAvailable() const {
+    // The mixer always produces audio (silence when no track has data)
+    return QIODevice::bytesAvailable() + bytesPerFrame_ * mixer_->outputSampleRate() / 10;
+}
+
+qint64 MixerOutputDevice::readData(char* data, qint64 maxSize) {
+    const qint64 frames = maxSize / bytesPerFrame_;
+    if (frames <= 0) {
+        return 0;
+    }
+    mixer_->mix(reinterpret_cast<int16_t*>(data), static_cast<size_t>(frames));
+
+    if (renderTap_) {
+        // Audio still queued in the sink plays before this buffer
+        qint64 queuedFrames = 0;
+        if (sink_) {
+            queuedFrames = std::max<qint64>(0, sink_->bufferSize() - sink_->bytesFree()) / bytesPerFrame_;
+        }
+        const int queuedMs = static_cast<int>(queuedFrames * 1000 / mixer_->outputSampleRate());
+        renderTap_->write(reinterpret_cast<const int16_t*>(data), static_cast<size_t>(frames), queuedMs);
+    }
+    return frames * bytesPerFrame_;
+}
+
+qint64 MixerOutputDevice::writeData(const char*, qint64) {
+    return -1;
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Pull-mode QIODevice over AudioMixer
+ */
+
+#ifndef AUDIO_MIXER_OUTPUT_DEVICE_H_
+#define AUDIO_MIXER_OUTPUT_DEVICE_H_
+
+#include <QAudioSink>
+#include <QIODevice>
+#include "audio_mixer.h"
+#include "render_reference_tap.h"
+
+namespace links {
+namespace audio {
+
+// Source device for a QAudioSink started in pull mode. Every read is served
+// by mixing straight into the sink's buffer, so playback is paced by the
+// output device clock rather than by frame arrival.
+//
+// With a RenderReferenceTap attached, every mixed buffer is also forwarded as
+// the echo canceller's far-end reference, together with the amount of audio
+// the sink still had queued ahead of it.
+class MixerOutputDevice : public QIODevice {
+    Q_OBJECT
+
+public:
+    explicit MixerOutputDevice(AudioMixer* mixer, QObject* parent = nullptr);
+
+    // Both optional; must outlive the device
+    void setRenderTap(RenderReferenceTap* tap, const QAudioSink* sink);
+
+    bool isSequential() const override { return true; }
+    qint64 bytesAvailable() const override;
+
+protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+private:
+    AudioMixer* mixer_;
+    qint64 bytesPerFrame_;
+    RenderReferenceTap* renderTap_{nullptr};
+    const QAudioSink* sink_{nullptr};
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_MIXER_OUTPUT_DEVICE_H_
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Echo Canceller Render Reference Tap
+ */
+
+#include "render_reference_tap.h"
+
+#include <algorithm>
+#include <cstring>
+#include "../audio_processing_module.h"
+
+namespace links {
+namespace audio {
+
+RenderReferenceTap::RenderReferenceTap() {
+    configure(sampleRate_, channels_);
+}
+
+void RenderReferenceTap::setProcessor(AudioProcessingModule* apm) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    apm_ = apm;
+    pendingFrames_ = 0;
+    if (convert_) {
+        converter_.reset();
+    }
+}
+
+bool RenderReferenceTap::hasProcessor() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return apm_ != nullptr;
+}
+
+bool RenderReferenceTap::isProcessingRate(int sampleRate) {
+    return sampleRate == 8000 || sampleRate == 16000 || sampleRate == 32000 || sampleRate == 48000;
+}
+
+void RenderReferenceTap::configure(int sampleRate, int channels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sampleRate = std::max(100, sampleRate);
+    deviceChannels_ = std::max(1, channels);
+    convert_ = !isProcessingRate(sampleRate);
+    if (convert_) {
+        converter_.configure(sampleRate, deviceChannels_, SampleFormat::Int16, kConvertChunkFrames);
+        converted_.assign(converter_.maxOutputFrames(kConvertChunkFrames), 0);
+        sampleRate_ = CaptureConverter::kOutputRate;
+        channels_ = 1;
+    } else {
+        converted_.clear();
+        sampleRate_ = sampleRate;
+        channels_ = deviceChannels_;
+    }
+    frameSize_ = static_cast<size_t>(sampleRate_ / 100);
+    pending_.assign(frameSize_ * static_cast<size_t>(channels_), 0);
+    pendingFrames_ = 0;
+}
+
+void RenderReferenceTap::write(const int16_t* samples, size_t frames, int queuedMs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!apm_ || !samples || frames == 0) {
+        return;
+    }
+    apm_->setRenderDelayMs(queuedMs);
+
+    if (!convert_) {
+        regroup(samples, frames);
+        return;
+    }
+    const size_t deviceChannels = static_cast<size_t>(deviceChannels_);
+    while (frames > 0) {
+        const size_t chunk = std::min(frames, kConvertChunkFrames);
+        const size_t produced = converter_.process(samples, chunk, converted_.data());
+        regroup(converted_.data(), produced);
+        samples += chunk * deviceChannels;
+        frames -= chunk;
+    }
+}
+
+void RenderReferenceTap::regroup(const int16_t* samples, size_t frames) {
+    const size_t channels = static_cast<size_t>(channels_);
+    while (frames > 0) {
+        // Whole frames straight from the device buffer, the rest via pending_
+        if (pendingFrames_ == 0 && frames >= frameSize_) {
+            forward(samples);
+            samples += frameSize_ * channels;
+            frames -= frameSize_;
+            continue;
+        }
+
+        const size_t take = std::min(frames, frameSize_ - pendingFrames_);
+        std::memcpy(pending_.data() + pendingFrames_ * channels, samples, take * channels * sizeof(int16_t));
+        pendingFrames_ += take;
+        samples += take * channels;
+        frames -= take;
+        if (pendingFrames_ == frameSize_) {
+            forward(pending_.data());
+            pendingFrames_ = 0;
+        }
+    }
+}
+
+int64_t RenderReferenceTap::framesForwarded() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return framesForwarded_;
+}
+
+int64_t RenderReferenceTap::framesRejected() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return framesRejected_;
+}
+
+void RenderReferenceTap::forward(const int16_t* frame) {
+    if (!apm_->processRenderFrame(frame, static_cast<int>(frameSize_), sampleRate_, channels_)) {
+        ++framesRejected_;
+    }
+    ++framesForwarded_;
+}
+
+}  // namespace audio
+}  // namespace links
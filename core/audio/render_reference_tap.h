@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Echo Canceller Render Reference Tap
+ */
+
+#ifndef AUDIO_RENDER_REFERENCE_TAP_H_
+#define AUDIO_RENDER_REFERENCE_TAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "capture_converter.h"
+
+class AudioProcessingModule;
+
+namespace links {
+namespace audio {
+
+// Forwards the mixed remote audio, exactly as handed to the output device, to
+// the microphone's AudioProcessingModule as the echo canceller's far-end
+// reference. Device pulls of any size are regrouped into 10 ms frames, and
+// the output queued ahead of each pull is reported as the render half of the
+// stream delay. APM's render side only takes 8/16/32/48 kHz; output at any
+// other rate (44.1 kHz devices) is converted to 48 kHz mono first.
+//
+// write() is called on the playback thread; setProcessor() and configure()
+// may be called from any thread. The lock is only contended while the
+// processor is being swapped.
+class RenderReferenceTap {
+public:
+    RenderReferenceTap();
+
+    RenderReferenceTap(const RenderReferenceTap&) = delete;
+    RenderReferenceTap& operator=(const RenderReferenceTap&) = delete;
+
+    // nullptr detaches; the caller keeps |apm| alive until it is detached
+    void setProcessor(AudioProcessingModule* apm);
+    bool hasProcessor() const;
+
+    // Output format of the playback stream; drops any partial frame
+    void configure(int sampleRate, int channels);
+
+    // |frames| interleaved frames just mixed for the device, with |queuedMs|
+    // of earlier output still waiting to be played
+    void write(const int16_t* samples, size_t frames, int queuedMs);
+
+    // Render frames forwarded so far, and how many of them APM rejected
+    int64_t framesForwarded() const;
+    int64_t framesRejected() const;
+
+    // True if APM accepts 10 ms int16 render frames at |sampleRate|
+    static bool isProcessingRate(int sampleRate);
+
+private:
+    void regroup(const int16_t* samples, size_t frames);
+    void forward(const int16_t* frame);
+
+    // Largest device pull converted at once; longer pulls are split
+    static constexpr size_t kConvertChunkFrames = 2048;
+
+    mutable std::mutex mutex_;
+    AudioProcessingModule* apm_ = nullptr;
+    // Format of the frames handed to APM (the device format, or 48 kHz mono
+    // behind the converter)
+    int sampleRate_ = 48000;
+    int channels_ = 2;
+    size_t frameSize_ = 480;
+    int deviceChannels_ = 2;
+    bool convert_ = false;
+    CaptureConverter converter_;
+    std::vector<int16_t> converted_;
+    std::vector<int16_t> pending_;
+    size_t pendingFrames_ = 0;
+    int64_t framesForwarded_ = 0;
+    int64_t framesRejected_ = 0;
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_RENDER_REFERENCE_TAP_H_
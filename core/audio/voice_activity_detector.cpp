@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Voice Activity Detector
+ */
+
+#include "voice_activity_detector.h"
+
+#include <algorithm>
+#include <cmath>
+#include "audio_kernels.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+constexpr double kFullScaleSquared = 32768.0 * 32768.0;
+
+// The floor follows quieter frames within ~100 ms but creeps up slowly, so
+// steady background noise lifts the thresholds while the gaps between words
+// keep pulling it back down during speech
+constexpr double kFloorFallTimeMs = 100.0;
+constexpr double kFloorRiseDbPerSecond = 2.0;
+constexpr float kMinFloorDb = -90.0f;
+constexpr float kMaxFloorDb = -40.0f;
+
+// Level meter: instant attack, ~300 ms decay, mapped from -60..0 dBFS
+constexpr double kLevelDecayMs = 300.0;
+constexpr float kLevelRangeDb = 60.0f;
+
+float toDb(double ratio) {
+    if (ratio <= 0.0) {
+        return VoiceActivityDetector::kSilenceDb;
+    }
+    return std::max(VoiceActivityDetector::kSilenceDb, static_cast<float>(10.0 * std::log10(ratio)));
+}
+
+}  // namespace
+
+bool VoiceActivityDetector::process(const int16_t* samples, size_t samplesPerChannel,
+                                    int sampleRate, int channels) {
+    if (!samples || samplesPerChannel == 0 || sampleRate <= 0 || channels <= 0) {
+        return false;
+    }
+
+    const size_t count = samplesPerChannel * static_cast<size_t>(channels);
+    uint64_t sumSquares = 0;
+    int32_t peak = 0;
+    kernels::sumSquaresAndPeak(samples, count, &sumSquares, &peak);
+
+    const double frameMs = 1000.0 * static_cast<double>(samplesPerChannel) / sampleRate;
+    const float rmsDb = toDb(static_cast<double>(sumSquares) / static_cast<double>(count) / kFullScaleSquared);
+    peakDb_.store(toDb(static_cast<double>(peak) * peak / kFullScaleSquared), std::memory_order_relaxed);
+
+    if (rmsDb < noiseFloorDb_) {
+        noiseFloorDb_ += (rmsDb - noiseFloorDb_) * static_cast<float>(std::min(1.0, frameMs / kFloorFallTimeMs));
+    } else {
+        noiseFloorDb_ += std::min(rmsDb - noiseFloorDb_,
+                                  static_cast<float>(kFloorRiseDbPerSecond * frameMs / 1000.0));
+    }
+    noiseFloorDb_ = std::clamp(noiseFloorDb_, kMinFloorDb, kMaxFloorDb);
+
+    const float onsetDb = std::max(noiseFloorDb_ + kOnsetMarginDb, kMinOnsetDb);
+    const float releaseDb = std::max(noiseFloorDb_ + kReleaseMarginDb, kMinReleaseDb);
+
+    bool speaking = speaking_.load(std::memory_order_relaxed);
+    bool changed = false;
+    if (!speaking) {
+        // Short dips during the onset only slow the attack down
+        aboveMs_ = rmsDb >= onsetDb ? aboveMs_ + frameMs : std::max(0.0, aboveMs_ - frameMs);
+        if (aboveMs_ >= kAttackMs) {
+            speaking = true;
+            belowMs_ = 0.0;
+            changed = true;
+        }
+    } else {
+        belowMs_ = rmsDb < releaseDb ? belowMs_ + frameMs : 0.0;
+        if (belowMs_ >= kReleaseMs) {
+            speaking = false;
+            aboveMs_ = 0.0;
+            changed = true;
+        }
+    }
+
+    if (rmsDb > smoothedDb_) {
+        smoothedDb_ = rmsDb;
+    } else {
+        smoothedDb_ += (rmsDb - smoothedDb_) * static_cast<float>(std::min(1.0, frameMs / kLevelDecayMs));
+    }
+    level_.store(std::clamp((smoothedDb_ + kLevelRangeDb) / kLevelRangeDb, 0.0f, 1.0f),
+                 std::memory_order_relaxed);
+
+    if (changed) {
+        speaking_.store(speaking, std::memory_order_relaxed);
+    }
+    return changed;
+}
+
+bool VoiceActivityDetector::reset() {
+    const bool wasSpeaking = speaking_.exchange(false, std::memory_order_relaxed);
+    aboveMs_ = 0.0;
+    belowMs_ = 0.0;
+    smoothedDb_ = kSilenceDb;
+    level_.store(0.0f, std::memory_order_relaxed);
+    peakDb_.store(kSilenceDb, std::memory_order_relaxed);
+    return wasSpeaking;
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Audio - Voice Activity Detector
+ */
+
+#ifndef AUDIO_VOICE_ACTIVITY_DETECTOR_H_
+#define AUDIO_VOICE_ACTIVITY_DETECTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace links {
+namespace audio {
+
+// Energy-based speaking detector for one audio track.
+//
+// Each frame's RMS and peak are measured with the SIMD level kernel and
+// compared against an adaptive noise floor. A track has to stay above the
+// onset threshold for the attack time before it counts as speaking, and
+// below the (lower) release threshold for the release time before it stops,
+// so word gaps and single clicks do not toggle the state.
+//
+// process() and reset() are called by one thread (the track's reader or the
+// capture thread); isSpeaking() and level() may be read from any thread.
+class VoiceActivityDetector {
+public:
+    VoiceActivityDetector() = default;
+
+    VoiceActivityDetector(const VoiceActivityDetector&) = delete;
+    VoiceActivityDetector& operator=(const VoiceActivityDetector&) = delete;
+
+    // Analyses one frame of interleaved samples. Returns true when the
+    // speaking state changed.
+    bool process(const int16_t* samples, size_t samplesPerChannel, int sampleRate, int channels);
+
+    // Returns to the silent state; true if the detector was speaking
+    bool reset();
+
+    bool isSpeaking() const { return speaking_.load(std::memory_order_relaxed); }
+
+    // Smoothed loudness in [0, 1] (-60..0 dBFS), for ranking and meters
+    float level() const { return level_.load(std::memory_order_relaxed); }
+
+    // Peak of the last frame in dBFS
+    float peakDb() const { return peakDb_.load(std::memory_order_relaxed); }
+
+    float noiseFloorDb() const { return noiseFloorDb_; }
+
+    static constexpr int kAttackMs = 30;
+    static constexpr int kReleaseMs = 400;
+    static constexpr float kSilenceDb = -100.0f;
+
+private:
+    // Onset/release margins above the noise floor, and absolute minimums so a
+    // near-silent floor cannot turn breathing into speech
+    static constexpr float kOnsetMarginDb = 12.0f;
+    static constexpr float kReleaseMarginDb = 6.0f;
+    static constexpr float kMinOnsetDb = -50.0f;
+    static constexpr float kMinReleaseDb = -56.0f;
+
+    float noiseFloorDb_ = -70.0f;
+    float smoothedDb_ = kSilenceDb;
+    double aboveMs_ = 0.0;
+    double belowMs_ = 0.0;
+
+    std::atomic<bool> speaking_{false};
+    std::atomic<float> level_{0.0f};
+    std::atomic<float> peakDb_{kSilenceDb};
+};
+
+}  // namespace audio
+}  // namespace links
+
+#endif  // AUDIO_VOICE_ACTIVITY_DETECTOR_H_
@@ -17,7 +17,49 @@
 #include "api/audio/audio_processing.h"
 #include "api/scoped_refptr.h"
 
-AudioProcessingModule::AudioProcessingModule() = default;
+#include <algorithm>
+#include <atomic>
+
+struct AudioProcessingModule::RuntimeState {
+    // Written by the setters, read by processFrame/processRenderFrame
+    std::atomic<bool> echoCancellationEnabled{true};
+    std::atomic<bool> noiseSuppressionEnabled{true};
+    std::atomic<bool> autoGainControlEnabled{true};
+    
+    // Smoothed halves of the stream delay; each has a single writer
+    std::atomic<int> renderDelayMs{0};
+    std::atomic<int> captureDelayMs{0};
+    
+    // Output of ProcessReverseStream (unused, render thread only)
+    std::vector<int16_t> renderScratch;
+    // ProcessReverseStream failures so far (render thread only)
+    int64_t renderErrors = 0;
+};
+
+namespace {
+
+// APM accepts stream delays up to 500ms
+constexpr int kMaxStreamDelayMs = 500;
+
+// A failing render stream fails every 10 ms; log the first error and then
+// one in this many (about every 5 s)
+constexpr int64_t kRenderErrorLogInterval = 500;
+
+// One-pole smoothing (1/8 per update) so per-callback buffer fill changes
+// do not make the AEC chase its delay hint; the last few ms snap to the
+// target so integer rounding cannot stall short of it
+int smoothDelay(int previous, int sample)
+{
+    const int step = (sample - previous) / 8;
+    return step != 0 ? previous + step : sample;
+}
+
+}  // namespace
+
+AudioProcessingModule::AudioProcessingModule()
+    : runtime_(std::make_unique<RuntimeState>())
+{
+}
 
 AudioProcessingModule::~AudioProcessingModule() = default;
 
@@ -34,11 +76,11 @@ bool AudioProcessingModule::initialize()
     webrtc::AudioProcessingBuilder builder;
     
     webrtc::AudioProcessing::Config config;
-    config.echo_canceller.enabled = echoCancellationEnabled_;
+    config.echo_canceller.enabled = isEchoCancellationEnabled();
     config.echo_canceller.mobile_mode = false;
-    config.noise_suppression.enabled = noiseSuppressionEnabled_;
+    config.noise_suppression.enabled = isNoiseSuppressionEnabled();
     config.noise_suppression.level = webrtc::AudioProcessing::Config::NoiseSuppression::kModerate;
-    config.gain_controller2.enabled = autoGainControlEnabled_;
+    config.gain_controller2.enabled = isAutoGainControlEnabled();
     config.high_pass_filter.enabled = true;
     
     builder.SetConfig(config);
@@ -48,9 +90,9 @@ bool AudioProcessingModule::initialize()
         apm_ = std::unique_ptr<webrtc::AudioProcessing>(apm.release());
 #ifndef AUDIO_PROCESSING_TESTS
         Logger::instance().info(QString("WebRTC APM initialized (AEC=%1, NS=%2, AGC=%3)")
-                               .arg(echoCancellationEnabled_)
-                               .arg(noiseSuppressionEnabled_)
-                               .arg(autoGainControlEnabled_));
+                               .arg(config.echo_canceller.enabled)
+                               .arg(config.noise_suppression.enabled)
+                               .arg(config.gain_controller2.enabled));
 #endif
         return true;
     } else {
@@ -66,22 +108,24 @@ void AudioProcessingModule::applyConfig()
     }
     
     webrtc::AudioProcessing::Config config = apm_->GetConfig();
-    config.echo_canceller.enabled = echoCancellationEnabled_;
-    config.noise_suppression.enabled = noiseSuppressionEnabled_;
-    config.gain_controller2.enabled = autoGainControlEnabled_;
+    config.echo_canceller.enabled = isEchoCancellationEnabled();
+    config.noise_suppression.enabled = isNoiseSuppressionEnabled();
+    config.gain_controller2.enabled = isAutoGainControlEnabled();
     apm_->ApplyConfig(config);
     
 #ifndef AUDIO_PROCESSING_TESTS
     Logger::instance().info(QString("APM config updated (AEC=%1, NS=%2, AGC=%3)")
-                           .arg(echoCancellationEnabled_)
-                           .arg(noiseSuppressionEnabled_)
-                           .arg(autoGainControlEnabled_));
+                           .arg(config.echo_canceller.enabled)
+                           .arg(config.noise_suppression.enabled)
+                           .arg(config.gain_controller2.enabled));
 #endif
 }
 
 void AudioProcessingModule::setEchoCancellationEnabled(bool enabled)
 {
-    echoCancellationEnabled_ = enabled;
+    if (runtime_) {
+        runtime_->echoCancellationEnabled.store(enabled, std::memory_order_relaxed);
+    }
     applyConfig();
 #ifndef AUDIO_PROCESSING_TESTS
     Logger::instance().info(QString("Echo cancellation %1").arg(enabled ? "enabled" : "disabled"));
@@ -90,7 +134,9 @@ void AudioProcessingModule::setEchoCancellationEnabled(bool enabled)
 
 void AudioProcessingModule::setNoiseSuppressionEnabled(bool enabled)
 {
-    noiseSuppressionEnabled_ = enabled;
+    if (runtime_) {
+        runtime_->noiseSuppressionEnabled.store(enabled, std::memory_order_relaxed);
+    }
     applyConfig();
 #ifndef AUDIO_PROCESSING_TESTS
     Logger::instance().info(QString("Noise suppression %1").arg(enabled ? "enabled" : "disabled"));
@@ -99,13 +145,30 @@ void AudioProcessingModule::setNoiseSuppressionEnabled(bool enabled)
 
 void AudioProcessingModule::setAutoGainControlEnabled(bool enabled)
 {
-    autoGainControlEnabled_ = enabled;
+    if (runtime_) {
+        runtime_->autoGainControlEnabled.store(enabled, std::memory_order_relaxed);
+    }
     applyConfig();
 #ifndef AUDIO_PROCESSING_TESTS
     Logger::instance().info(QString("Auto gain control %1").arg(enabled ? "enabled" : "disabled"));
 #endif
 }
 
+bool AudioProcessingModule::isEchoCancellationEnabled() const
+{
+    return runtime_ && runtime_->echoCancellationEnabled.load(std::memory_order_relaxed);
+}
+
+bool AudioProcessingModule::isNoiseSuppressionEnabled() const
+{
+    return runtime_ && runtime_->noiseSuppressionEnabled.load(std::memory_order_relaxed);
+}
+
+bool AudioProcessingModule::isAutoGainControlEnabled() const
+{
+    return runtime_ && runtime_->autoGainControlEnabled.load(std::memory_order_relaxed);
+}
+
 bool AudioProcessingModule::processFrame(int16_t* data, int samples, int sampleRate, int channels)
 {
     if (!apm_ || !data || samples <= 0) {
@@ -117,10 +180,16 @@ bool AudioProcessingModule::processFrame(int16_t* data, int samples, int sampleR
     int processedSamples = 0;
     
     webrtc::StreamConfig streamConfig(sampleRate, channels);
+    const bool echoCancellation = isEchoCancellationEnabled();
     
     while (processedSamples + frameSize <= samples) {
         int16_t* framePtr = data + processedSamples * channels;
         
+        // Tell the echo canceller where to look for the render reference
+        if (echoCancellation) {
+            apm_->set_stream_delay_ms(streamDelayMs());
+        }
+        
         // Process the capture stream (near-end)
         int result = apm_->ProcessStream(
             framePtr,
@@ -141,3 +210,79 @@ bool AudioProcessingModule::processFrame(int16_t* data, int samples, int sampleR
     
     return true;
 }
+
+bool AudioProcessingModule::processRenderFrame(const int16_t* data, int samples, int sampleRate, int channels)
+{
+    if (!apm_ || !runtime_ || !data || samples <= 0) {
+        return false;
+    }
+    if (!runtime_->echoCancellationEnabled.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    
+    const int frameSize = sampleRate / 100; // samples per 10ms
+    webrtc::StreamConfig streamConfig(sampleRate, channels);
+    
+    std::vector<int16_t>& scratch = runtime_->renderScratch;
+    const size_t frameTotal = static_cast<size_t>(frameSize) * channels;
+    if (scratch.size() < frameTotal) {
+        scratch.resize(frameTotal);
+    }
+    
+    for (int processed = 0; processed + frameSize <= samples; processed += frameSize) {
+        // Analyse the far-end stream (render side); the output is not used
+        int result = apm_->ProcessReverseStream(
+            data + processed * channels,
+            streamConfig,
+            streamConfig,
+            scratch.data()
+        );
+        
+        if (result != webrtc::AudioProcessing::kNoError) {
+#ifndef AUDIO_PROCESSING_TESTS
+            if (runtime_->renderErrors % kRenderErrorLogInterval == 0) {
+                Logger::instance().warning(QString("APM ProcessReverseStream error: %1 at %2 Hz (%3 so far)")
+                                               .arg(result).arg(sampleRate).arg(runtime_->renderErrors + 1));
+            }
+#endif
+            ++runtime_->renderErrors;
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+void AudioProcessingModule::setRenderDelayMs(int delayMs)
+{
+    if (runtime_) {
+        const int previous = runtime_->renderDelayMs.load(std::memory_order_relaxed);
+        runtime_->renderDelayMs.store(smoothDelay(previous, std::max(0, delayMs)), std::memory_order_relaxed);
+    }
+}
+
+void AudioProcessingModule::setCaptureDelayMs(int delayMs)
+{
+    if (runtime_) {
+        const int previous = runtime_->captureDelayMs.load(std::memory_order_relaxed);
+        runtime_->captureDelayMs.store(smoothDelay(previous, std::max(0, delayMs)), std::memory_order_relaxed);
+    }
+}
+
+int AudioProcessingModule::streamDelayMs() const
+{
+    if (!runtime_) {
+        return 0;
+    }
+    const int delay = runtime_->renderDelayMs.load(std::memory_order_relaxed)
+                      + runtime_->captureDelayMs.load(std::memory_order_relaxed);
+    return std::min(delay, kMaxStreamDelayMs);
+}
+
+double AudioProcessingModule::echoReturnLossEnhancementDb() const
+{
+    if (!apm_) {
+        return 0.0;
+    }
+    return apm_->GetStatistics(true).echo_return_loss_enhancement.value_or(0.0);
+}
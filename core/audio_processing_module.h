@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <cstdint>
+#include <vector>
 
 // Forward declaration
 namespace webrtc {
@@ -17,6 +18,13 @@ class AudioProcessing;
  * 
  * This class is designed to be reusable and decoupled from any specific
  * audio capture implementation.
+ * 
+ * Threading: processFrame() runs on the capture thread and
+ * processRenderFrame() on the playback thread; the two may run concurrently
+ * (WebRTC APM locks its render and capture sides separately). The delay
+ * setters may be called from any thread. The enable setters are called from
+ * the GUI thread while capture runs; the flags they set are atomics read by
+ * both processing threads, and APM applies its config under its own locks.
  */
 class AudioProcessingModule {
 public:
@@ -49,9 +57,9 @@ public:
     void setNoiseSuppressionEnabled(bool enabled);
     void setAutoGainControlEnabled(bool enabled);
     
-    bool isEchoCancellationEnabled() const { return echoCancellationEnabled_; }
-    bool isNoiseSuppressionEnabled() const { return noiseSuppressionEnabled_; }
-    bool isAutoGainControlEnabled() const { return autoGainControlEnabled_; }
+    bool isEchoCancellationEnabled() const;
+    bool isNoiseSuppressionEnabled() const;
+    bool isAutoGainControlEnabled() const;
     
     /**
      * Process an audio frame in-place
@@ -64,13 +72,42 @@ public:
      */
     bool processFrame(int16_t* data, int samples, int sampleRate, int channels);
     
+    /**
+     * Feed far-end (render) audio as the echo canceller's reference
+     * 
+     * Call with the audio handed to the output device, in the same layout as
+     * processFrame. Frames are consumed in 10ms chunks; nothing is modified.
+     * Skipped while echo cancellation is disabled.
+     */
+    bool processRenderFrame(const int16_t* data, int samples, int sampleRate, int channels);
+    
+    /**
+     * Stream delay estimation
+     * 
+     * The delay between a render frame and its echo in the capture stream is
+     * the output queued ahead of the rendered frame plus the capture-side
+     * buffering before processFrame. Each side reports its own part; the
+     * smoothed sum is passed to APM before every capture frame.
+     */
+    void setRenderDelayMs(int delayMs);
+    void setCaptureDelayMs(int delayMs);
+    int streamDelayMs() const;
+    
+    /**
+     * Echo return loss enhancement reported by the echo canceller, in dB
+     * (0 when unavailable)
+     */
+    double echoReturnLossEnhancementDb() const;
+    
 private:
     void applyConfig();
     
+    // State shared between the GUI, capture and render threads, including
+    // the enable flags (kept behind a pointer so the module stays movable)
+    struct RuntimeState;
+    
     std::unique_ptr<webrtc::AudioProcessing> apm_;
-    bool echoCancellationEnabled_{true};
-    bool noiseSuppressionEnabled_{true};
-    bool autoGainControlEnabled_{true};
+    std::unique_ptr<RuntimeState> runtime_;
 };
 
 #endif // AUDIO_PROCESSING_MODULE_H
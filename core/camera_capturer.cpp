@@ -1,18 +1,28 @@
 #include "camera_capturer.h"
 #include "../utils/logger.h"
-#include "livekit/video_frame.h"
+#include <QCameraFormat>
 #include <QMediaDevices>
-#include <QImage>
-#include <QDateTime>
+#include <QTimer>
+#include <vector>
 
 CameraCapturer::CameraCapturer(QObject* parent)
     : QObject(parent),
       isActive_(false),
-      frameCount_(0)
+      frameCount_(0),
+      frameWorker_(new links::video::CameraFrameWorker())
 {
+    processingThread_.setObjectName("CameraProcessing");
+    frameWorker_->moveToThread(&processingThread_);
+    frameWorker_->setTargetFps(targetFps_);
+    connect(frameWorker_, &links::video::CameraFrameWorker::frameSent,
+            this, &CameraCapturer::onFrameSent);
+    connect(frameWorker_, &links::video::CameraFrameWorker::previewReady,
+            this, &CameraCapturer::frameCaptured);
+    
     // Create LiveKit video source (640x480 default)
     try {
         videoSource_ = std::make_shared<livekit::VideoSource>(640, 480);
+        frameWorker_->setVideoSource(videoSource_);
         Logger::instance().info("VideoSource created for camera");
     } catch (const std::exception& e) {
         Logger::instance().error(QString("Failed to create VideoSource: %1").arg(e.what()));
@@ -20,15 +30,21 @@ CameraCapturer::CameraCapturer(QObject* parent)
         return;
     }
     
-    // Initialize frame timer
-    frameTimer_.start();
-    
     // Defer actual camera initialization to start() so we can retry if no device is present at construction time
 }
 
 CameraCapturer::~CameraCapturer()
 {
     stop();
+    // The gate keeps a sink that is still emitting away from this object
+    // and the worker; the session itself goes once its camera has stopped
+    retireSession(std::move(camera_), std::move(captureSession_), std::move(videoSink_),
+                  std::move(sinkGate_));
+    if (processingThread_.isRunning()) {
+        processingThread_.quit();
+        processingThread_.wait();
+    }
+    delete frameWorker_;
 }
 
 bool CameraCapturer::start()
@@ -76,13 +92,22 @@ bool CameraCapturer::start()
         videoSink_ = std::make_unique<QVideoSink>();
         captureSession_->setVideoSink(videoSink_.get());
 
-        connect(videoSink_.get(), &QVideoSink::videoFrameChanged,
-                this, &CameraCapturer::onVideoFrameChanged);
+        connectSink(videoSink_.get());
+    }
+    
+    if (!processingThread_.isRunning()) {
+        processingThread_.start();
     }
     
+    applyCameraFormat(camera_.get(), camera_->cameraDevice());
+    
     try {
+        beginFirstFrameMeasurement(false);
+        frameWorker_->reset();
+        frameWorker_->setEnabled(videoSource_ != nullptr);
         camera_->start();
         isActive_ = true;
+        standby_ = false;
         frameCount_ = 0;
         Logger::instance().info("Camera started");
         return true;
@@ -95,101 +120,319 @@ bool CameraCapturer::start()
 
 void CameraCapturer::stop()
 {
+    if (pendingCamera_) {
+        abandonSwitch("capture stopped");
+    }
     if (!isActive_) {
         return;
     }
     
+    frameWorker_->setEnabled(false);
     if (camera_) {
         camera_->stop();
     }
     
     isActive_ = false;
-    Logger::instance().info(QString("Camera stopped (captured %1 frames)").arg(frameCount_));
+    standby_ = false;
+    awaitingFirstFrame_ = false;
+    const links::video::CameraFrameStats stats = frameWorker_->statistics();
+    Logger::instance().info(QString("Camera stopped (captured %1 frames; %2 received, %3 superseded, %4 rate-limited)")
+                           .arg(frameCount_)
+                           .arg(stats.received)
+                           .arg(stats.superseded)
+                           .arg(stats.rateLimited));
 }
 
-QList<QCameraDevice> CameraCapturer::availableCameras()
+void CameraCapturer::enterStandby()
 {
-    return QMediaDevices::videoInputs();
+    if (!isActive_ || standby_) {
+        return;
+    }
+    standby_ = true;
+    frameWorker_->setEnabled(false);
+    awaitingFirstFrame_ = false;
+    Logger::instance().info(QString("Camera in standby (captured %1 frames)").arg(frameCount_));
 }
 
-void CameraCapturer::onVideoFrameChanged(const QVideoFrame& frame)
+void CameraCapturer::resume()
 {
-    if (!isActive_ || !videoSource_) {
+    if (!isActive_ || !standby_) {
         return;
     }
+    beginFirstFrameMeasurement(true);
+    standby_ = false;
+    frameWorker_->setEnabled(videoSource_ != nullptr);
+    Logger::instance().info("Camera resumed from standby");
+}
+
+void CameraCapturer::beginFirstFrameMeasurement(bool fromStandby)
+{
+    firstFrameTimer_.start();
+    awaitingFirstFrame_ = true;
+    resumedFromStandby_ = fromStandby;
+    timeToFirstFrameMs_ = -1;
+}
+
+QList<QCameraDevice> CameraCapturer::availableCameras()
+{
+    return QMediaDevices::videoInputs();
+}
+
+void CameraCapturer::setTargetFps(int fps)
+{
+    targetFps_ = fps;
+    frameWorker_->setTargetFps(fps);
+}
+
+void CameraCapturer::setQuality(links::video::CameraQuality quality)
+{
+    quality_ = quality;
+    setTargetFps(links::video::captureProfile(quality).fps);
+    if (isActive_ && camera_) {
+        applyCameraFormat(camera_.get(), camera_->cameraDevice());
+    }
+}
+
+void CameraCapturer::applyCameraFormat(QCamera* camera, const QCameraDevice& device)
+{
+    using links::video::CameraEncoding;
+    
+    const QList<QCameraFormat> formats = device.videoFormats();
+    std::vector<links::video::CameraMode> modes;
+    modes.reserve(formats.size());
+    for (const QCameraFormat& format : formats) {
+        links::video::CameraMode mode;
+        mode.width = format.resolution().width();
+        mode.height = format.resolution().height();
+        mode.minFps = format.minFrameRate();
+        mode.maxFps = format.maxFrameRate();
+        switch (format.pixelFormat()) {
+            case QVideoFrameFormat::Format_NV12:
+            case QVideoFrameFormat::Format_NV21:
+            case QVideoFrameFormat::Format_YUYV:
+            case QVideoFrameFormat::Format_UYVY:
+            case QVideoFrameFormat::Format_YUV420P:
+            case QVideoFrameFormat::Format_YV12:
+                mode.encoding = CameraEncoding::RawYuv;
+                break;
+            case QVideoFrameFormat::Format_ARGB8888:
+            case QVideoFrameFormat::Format_ARGB8888_Premultiplied:
+            case QVideoFrameFormat::Format_XRGB8888:
+            case QVideoFrameFormat::Format_BGRA8888:
+            case QVideoFrameFormat::Format_BGRA8888_Premultiplied:
+            case QVideoFrameFormat::Format_BGRX8888:
+            case QVideoFrameFormat::Format_ABGR8888:
+            case QVideoFrameFormat::Format_XBGR8888:
+            case QVideoFrameFormat::Format_RGBA8888:
+            case QVideoFrameFormat::Format_RGBX8888:
+                mode.encoding = CameraEncoding::Rgb;
+                break;
+            case QVideoFrameFormat::Format_Jpeg:
+                mode.encoding = CameraEncoding::Mjpeg;
+                break;
+            default:
+                mode.encoding = CameraEncoding::Other;
+                break;
+        }
+        modes.push_back(mode);
+    }
+    
+    const links::video::CaptureProfile profile = links::video::captureProfile(quality_);
+    const int index = links::video::selectCameraMode(modes, profile);
+    if (index < 0) {
+        Logger::instance().warning(QString("Camera '%1' reports no formats, using its default mode")
+                                  .arg(device.description()));
+        return;
+    }
+    
+    const QCameraFormat& chosen = formats.at(index);
+    camera->setCameraFormat(chosen);
+    Logger::instance().info(QString("Camera mode %1x%2 @ %3-%4 fps %5 for %6 profile %7x%8 @ %9 fps (%10 modes offered)")
+                           .arg(chosen.resolution().width())
+                           .arg(chosen.resolution().height())
+                           .arg(chosen.minFrameRate())
+                           .arg(chosen.maxFrameRate())
+                           .arg(QVideoFrameFormat::pixelFormatToString(chosen.pixelFormat()))
+                           .arg(links::video::qualityName(quality_))
+                           .arg(profile.width)
+                           .arg(profile.height)
+                           .arg(profile.fps)
+                           .arg(formats.size()));
+}
+
+void CameraCapturer::connectSink(QVideoSink* sink)
+{
+    sinkGate_ = std::make_shared<SinkGate>();
     
-    processFrame(frame);
-    emit frameReady(frame);
+    // Standby and stopped states are handled by the worker dropping frames
+    // on arrival, before anything touches their pixels
+    connect(sink, &QVideoSink::videoFrameChanged, frameWorker_,
+            [this, gate = sinkGate_](const QVideoFrame& frame) {
+                std::lock_guard<std::mutex> lock(gate->mutex);
+                if (gate->open && frameWorker_->isEnabled()) {
+                    frameWorker_->submit(frame);
+                    emit frameReady(frame);
+                }
+            }, Qt::DirectConnection);
 }
 
-void CameraCapturer::processFrame(const QVideoFrame& frame)
+void CameraCapturer::retireSession(std::unique_ptr<QCamera> camera,
+                                   std::unique_ptr<QMediaCaptureSession> session,
+                                   std::unique_ptr<QVideoSink> sink,
+                                   std::shared_ptr<SinkGate> gate)
 {
-    // Frame rate limiting - skip frames to maintain target FPS
-    qint64 currentTime = frameTimer_.elapsed();
-    if (currentTime - lastFrameTime_ < minFrameIntervalMs_) {
-        return; // Skip this frame to maintain target frame rate
+    if (gate) {
+        std::lock_guard<std::mutex> lock(gate->mutex);
+        gate->open = false;
     }
-    lastFrameTime_ = currentTime;
+    if (sink) {
+        disconnect(sink.get(), nullptr, frameWorker_, nullptr);
+        disconnect(sink.get(), nullptr, this, nullptr);
+    }
+    
+    QCamera* retiredCamera = camera.release();
+    QMediaCaptureSession* retiredSession = session.release();
+    QVideoSink* retiredSink = sink.release();
+    auto release = [retiredCamera, retiredSession, retiredSink]() {
+        if (retiredSink) {
+            retiredSink->deleteLater();
+        }
+        if (retiredSession) {
+            retiredSession->deleteLater();
+        }
+        if (retiredCamera) {
+            retiredCamera->deleteLater();
+        }
+    };
     
-    // Make the frame writable
-    QVideoFrame localFrame = frame;
-    if (!localFrame.map(QVideoFrame::ReadOnly)) {
-        Logger::instance().warning("Failed to map video frame");
+    if (!retiredCamera || !retiredCamera->isActive()) {
+        release();
+        return;
+    }
+    // Connected before stop() in case the backend stops synchronously. Both
+    // go with the camera, and repeating deleteLater before that is harmless.
+    connect(retiredCamera, &QCamera::activeChanged, retiredCamera, [release](bool active) {
+        if (!active) {
+            release();
+        }
+    });
+    QTimer::singleShot(kRetireTimeoutMs, retiredCamera, release);
+    retiredCamera->stop();
+}
+
+void CameraCapturer::onFrameSent(int width, int height)
+{
+    if (!isActive_) {
         return;
     }
     
-    // Convert to RGBA format for LiveKit - reuse cached image when possible
-    QImage image = localFrame.toImage();
-    localFrame.unmap();
+    if (awaitingFirstFrame_) {
+        awaitingFirstFrame_ = false;
+        timeToFirstFrameMs_ = firstFrameTimer_.elapsed();
+        Logger::instance().info(QString("Camera first frame after %1 ms (%2)")
+                               .arg(timeToFirstFrameMs_)
+                               .arg(resumedFromStandby_ ? "warm, from standby" : "cold start"));
+        emit firstFrameCaptured(timeToFirstFrameMs_, resumedFromStandby_);
+    }
     
-    if (image.isNull()) {
-        Logger::instance().warning("Failed to convert frame to image");
-        return;
+    frameCount_++;
+    
+    // Log every 30 frames (about 1 second at 30fps)
+    if (frameCount_ % 30 == 0) {
+        Logger::instance().debug(QString("Captured %1 frames (%2x%3)")
+                                .arg(frameCount_)
+                                .arg(width)
+                                .arg(height));
+    }
+}
+
+bool CameraCapturer::switchCamera(const QByteArray& deviceId)
+{
+    if (!isActive_) {
+        setCameraById(deviceId);
+        return true;
     }
     
-    // Convert to RGBA32 if needed - reuse cached image to avoid allocation
-    if (image.format() != QImage::Format_RGBA8888) {
-        // Reuse cached image if size matches
-        if (cachedRgbaImage_.width() == image.width() && 
-            cachedRgbaImage_.height() == image.height() &&
-            cachedRgbaImage_.format() == QImage::Format_RGBA8888) {
-            // Fast path: convert directly into cached buffer
-            image = image.convertToFormat(QImage::Format_RGBA8888);
-            cachedRgbaImage_ = image;
-        } else {
-            image = image.convertToFormat(QImage::Format_RGBA8888);
-            cachedRgbaImage_ = image;
+    QCameraDevice device = deviceId.isEmpty() ? QMediaDevices::defaultVideoInput() : QCameraDevice();
+    if (device.isNull()) {
+        for (const auto& candidate : QMediaDevices::videoInputs()) {
+            if (candidate.id() == deviceId) {
+                device = candidate;
+                break;
+            }
         }
     }
+    if (device.isNull()) {
+        Logger::instance().warning(QString("Camera with ID '%1' not found").arg(QString(deviceId)));
+        return false;
+    }
+    if (pendingCamera_) {
+        abandonSwitch("superseded by another switch");
+    }
     
-    // Send to LiveKit
-    try {
-        // Create VideoFrame from RGBA image data
-        std::vector<uint8_t> frameData(image.constBits(), image.constBits() + image.sizeInBytes());
-        livekit::VideoFrame frame(image.width(), image.height(), 
-                                  livekit::VideoBufferType::RGBA, 
-                                  std::move(frameData));
-        
-        // Capture frame with current timestamp in microseconds
-        int64_t timestamp_us = QDateTime::currentMSecsSinceEpoch() * 1000;
-        videoSource_->captureFrame(frame, timestamp_us);
-
-        emit frameCaptured(image);
-        
-        frameCount_++;
-        
-        // Log every 30 frames (about 1 second at 30fps)
-        if (frameCount_ % 30 == 0) {
-            Logger::instance().debug(QString("Captured %1 frames (%2x%3)")
-                                    .arg(frameCount_)
-                                    .arg(image.width())
-                                    .arg(image.height()));
+    // The new camera gets its own session and sink; the current one keeps
+    // feeding the VideoSource until the first valid frame arrives
+    pendingDevice_ = device;
+    pendingCamera_ = std::make_unique<QCamera>(device);
+    applyCameraFormat(pendingCamera_.get(), device);
+    pendingSession_ = std::make_unique<QMediaCaptureSession>();
+    pendingSession_->setCamera(pendingCamera_.get());
+    pendingSink_ = std::make_unique<QVideoSink>();
+    pendingSession_->setVideoSink(pendingSink_.get());
+    connect(pendingSink_.get(), &QVideoSink::videoFrameChanged,
+            this, &CameraCapturer::onPendingFrameChanged);
+    
+    switchClock_.start();
+    pendingCamera_->start();
+    Logger::instance().info(QString("Opened camera '%1' alongside the current one, waiting for a frame")
+                           .arg(device.description()));
+    
+    const int generation = ++switchGeneration_;
+    QTimer::singleShot(kSwitchTimeoutMs, this, [this, generation]() {
+        if (pendingCamera_ && generation == switchGeneration_) {
+            abandonSwitch("no frame from the new camera");
         }
-    } catch (const std::exception& e) {
-        Logger::instance().error(QString("Failed to capture frame: %1").arg(e.what()));
+    });
+    return true;
+}
+
+void CameraCapturer::onPendingFrameChanged(const QVideoFrame& frame)
+{
+    // Frames from a sink that was already retired may still be queued
+    if (!pendingCamera_ || sender() != pendingSink_.get() || !frame.isValid()) {
+        return;
+    }
+    
+    // Swap sessions. The old sink may be emitting on its own thread right
+    // now, so it is shut out and deleted only once its camera has stopped.
+    disconnect(pendingSink_.get(), nullptr, this, nullptr);
+    retireSession(std::move(camera_), std::move(captureSession_), std::move(videoSink_),
+                  std::move(sinkGate_));
+    captureSession_ = std::move(pendingSession_);
+    camera_ = std::move(pendingCamera_);
+    videoSink_ = std::move(pendingSink_);
+    connectSink(videoSink_.get());
+    selectedDevice_ = pendingDevice_;
+    frameWorker_->resetFormatLog();
+    
+    Logger::instance().info(QString("Camera switched to '%1' after %2 ms")
+                           .arg(selectedDevice_.description())
+                           .arg(switchClock_.elapsed()));
+    emit cameraSwitched(true);
+    
+    if (frameWorker_->isEnabled()) {
+        frameWorker_->submit(frame);
+        emit frameReady(frame);
     }
 }
 
+void CameraCapturer::abandonSwitch(const QString& reason)
+{
+    retireSession(std::move(pendingCamera_), std::move(pendingSession_), std::move(pendingSink_), nullptr);
+    Logger::instance().warning(QString("Camera switch abandoned (%1), keeping the current camera").arg(reason));
+    emit cameraSwitched(false);
+}
+
 void CameraCapturer::setCamera(const QCameraDevice& device)
 {
     if (isActive_) {
@@ -197,7 +440,9 @@ void CameraCapturer::setCamera(const QCameraDevice& device)
         return;
     }
     selectedDevice_ = device;
-    camera_.reset(); // Reset camera so it will be recreated with new device on next start()
+    // Recreated with the new device on next start()
+    retireSession(std::move(camera_), std::move(captureSession_), std::move(videoSink_),
+                  std::move(sinkGate_));
     Logger::instance().info(QString("Camera device set to: %1").arg(device.description()));
 }
 
@@ -8,9 +8,13 @@
 #include <QVideoFrame>
 #include <QImage>
 #include <QElapsedTimer>
+#include <QThread>
 #include <memory>
 #include <atomic>
+#include <mutex>
 #include "livekit/video_source.h"
+#include "video/camera_format_selector.h"
+#include "video/camera_frame_worker.h"
 
 class CameraCapturer : public QObject
 {
@@ -25,6 +29,17 @@ public:
     void stop();
     bool isActive() const { return isActive_; }
     
+    // Warm standby: the camera session stays open but frames are dropped on
+    // arrival (no mapping, conversion or captureFrame), so resuming skips the
+    // device start-up. Only valid while active; stop() leaves standby.
+    void enterStandby();
+    void resume();
+    bool isStandby() const { return standby_; }
+    
+    // Time from the last start()/resume() to the first frame sent, or -1
+    // while still waiting
+    qint64 timeToFirstFrameMs() const { return timeToFirstFrameMs_; }
+    
     // Get the LiveKit video source
     std::shared_ptr<livekit::VideoSource> getVideoSource() const { return videoSource_; }
     
@@ -35,40 +50,98 @@ public:
     void setCamera(const QCameraDevice& device);
     void setCameraById(const QByteArray& deviceId);
     
+    // Live switch while capturing: the new camera runs in its own session
+    // until it delivers a valid frame and then replaces the old one. The
+    // VideoSource is kept, so a published track is untouched. cameraSwitched()
+    // reports the outcome. When not capturing this only selects the camera.
+    bool switchCamera(const QByteArray& deviceId);
+    
     // Frame rate control
-    void setTargetFps(int fps) { targetFps_ = fps; minFrameIntervalMs_ = 1000 / fps; }
+    void setTargetFps(int fps);
     int getTargetFps() const { return targetFps_; }
     
+    // Capture quality: picks the camera mode closest to the profile's
+    // resolution and frame rate on every start or switch. Applied to a
+    // running camera immediately.
+    void setQuality(links::video::CameraQuality quality);
+    links::video::CameraQuality quality() const { return quality_; }
+    
+    // Received / superseded / rate-limited / sent counters since start()
+    links::video::CameraFrameStats frameStatistics() const { return frameWorker_->statistics(); }
+    
 signals:
     void frameReady(const QVideoFrame& frame);
     void frameCaptured(const QImage& image);
     void error(const QString& message);
+    void firstFrameCaptured(qint64 latencyMs, bool fromStandby);
+    void cameraSwitched(bool success);
     
 private slots:
-    void onVideoFrameChanged(const QVideoFrame& frame);
+    void onPendingFrameChanged(const QVideoFrame& frame);
+    void onFrameSent(int width, int height);
     
 private:
-    void processFrame(const QVideoFrame& frame);
+    // Closed before a sink's session is torn down. The frame callback runs
+    // on whatever thread the sink emits from and holds the mutex while it
+    // touches this object, so closing waits out a callback in progress and
+    // later ones return at once.
+    struct SinkGate {
+        std::mutex mutex;
+        bool open{true};
+    };
+    
+    // Frames go from the sink's thread straight into the worker's mailbox,
+    // bypassing this object's event loop. Opens a new sinkGate_.
+    void connectSink(QVideoSink* sink);
+    // Shuts a session out of the pipeline and stops its camera. The sink may
+    // keep emitting until the backend has really stopped, so the objects are
+    // only deleted (deleteLater) once the camera reports it is inactive.
+    void retireSession(std::unique_ptr<QCamera> camera,
+                       std::unique_ptr<QMediaCaptureSession> session,
+                       std::unique_ptr<QVideoSink> sink,
+                       std::shared_ptr<SinkGate> gate);
+    // Sets the QCameraFormat closest to the quality profile and logs it
+    void applyCameraFormat(QCamera* camera, const QCameraDevice& device);
+    void beginFirstFrameMeasurement(bool fromStandby);
+    void abandonSwitch(const QString& reason);
+    
+    // Replacement camera while a live switch is in progress
+    static constexpr int kSwitchTimeoutMs = 5000;
+    // A retired camera that never reports stopping is deleted after this
+    static constexpr int kRetireTimeoutMs = 3000;
+    std::unique_ptr<QCamera> pendingCamera_;
+    std::unique_ptr<QMediaCaptureSession> pendingSession_;
+    std::unique_ptr<QVideoSink> pendingSink_;
+    QCameraDevice pendingDevice_;
+    QElapsedTimer switchClock_;
+    int switchGeneration_{0};
     
     std::unique_ptr<QCamera> camera_;
     std::unique_ptr<QMediaCaptureSession> captureSession_;
     std::unique_ptr<QVideoSink> videoSink_;
+    std::shared_ptr<SinkGate> sinkGate_;
     std::shared_ptr<livekit::VideoSource> videoSource_;
     
     bool isActive_;
+    bool standby_{false};
     int frameCount_;
     
+    // Time-to-first-frame measurement for the current start()/resume()
+    QElapsedTimer firstFrameTimer_;
+    bool awaitingFirstFrame_{false};
+    bool resumedFromStandby_{false};
+    qint64 timeToFirstFrameMs_{-1};
+    
     // Frame rate control
     int targetFps_{30};
-    int minFrameIntervalMs_{33}; // ~30fps
-    QElapsedTimer frameTimer_;
-    qint64 lastFrameTime_{0};
-    
-    // Cached converted image to avoid repeated allocations
-    QImage cachedRgbaImage_;
+    links::video::CameraQuality quality_{links::video::CameraQuality::Standard};
     
     // Selected camera device
     QCameraDevice selectedDevice_;
+    
+    // Conversion and captureFrame run on this thread
+    QThread processingThread_;
+    links::video::CameraFrameWorker* frameWorker_;
 };
 
 #endif // CAMERA_CAPTURER_H
@@ -22,6 +22,7 @@ ConferenceManager::ConferenceManager(QObject* parent)
     Logger::instance().info("ConferenceManager created");
     qRegisterMetaType<livekit::TrackSource>("livekit::TrackSource");
     qRegisterMetaType<livekit::TrackKind>("livekit::TrackKind");
+    qRegisterMetaType<links::video::I420FrameRef>("links::video::I420FrameRef");
 
     roomController_->setDelegate(roomDelegate_.get());
 
@@ -59,6 +60,21 @@ ConferenceManager::ConferenceManager(QObject* parent)
                      this, &ConferenceManager::videoFrameReceived);
     QObject::connect(mediaPipeline_.get(), &MediaPipeline::audioActivity,
                      this, &ConferenceManager::audioActivity);
+    QObject::connect(mediaPipeline_.get(), &MediaPipeline::speakingChanged,
+                     this, &ConferenceManager::speakingChanged);
+    QObject::connect(mediaPipeline_.get(), &MediaPipeline::activeSpeakersChanged,
+                     this, &ConferenceManager::activeSpeakersChanged);
+    QObject::connect(mediaPipeline_.get(), &MediaPipeline::videoLayerRequested,
+                     this, &ConferenceManager::onVideoLayerRequested);
+
+    // Remote playback is the echo canceller's far-end reference
+    mediaPipeline_->setEchoCanceller(deviceController_->audioProcessingModule());
+
+    // The local microphone is ranked alongside remote tracks
+    mediaPipeline_->setLocalVoiceActivity(kLocalSpeakerId, deviceController_->localVoiceActivity());
+    QObject::connect(deviceController_.get(), &DeviceController::localSpeakingChanged, this, [this]() {
+        mediaPipeline_->updateSpeakingState(kLocalSpeakerId);
+    });
 }
 
 ConferenceManager::~ConferenceManager()
@@ -66,6 +82,8 @@ ConferenceManager::~ConferenceManager()
     if (connected_) {
         disconnect();
     }
+    // The APM belongs to the device controller, which is destroyed first
+    mediaPipeline_->setEchoCanceller(nullptr);
 }
 
 void ConferenceManager::connect(const QString& url, const QString& token)
@@ -131,6 +149,11 @@ void ConferenceManager::toggleMicrophone()
     deviceController_->toggleMicrophone();
 }
 
+void ConferenceManager::releaseMicrophone()
+{
+    deviceController_->releaseMicrophone();
+}
+
 void ConferenceManager::toggleCamera()
 {
     deviceController_->toggleCamera();
@@ -156,6 +179,11 @@ void ConferenceManager::switchMicrophone(const QString& deviceId)
     deviceController_->switchMicrophone(deviceId);
 }
 
+void ConferenceManager::setCameraQuality(const QString& quality)
+{
+    deviceController_->setCameraQuality(quality);
+}
+
 bool ConferenceManager::isMicrophoneEnabled() const
 {
     return deviceController_ && deviceController_->isMicrophoneEnabled();
@@ -281,7 +309,10 @@ void ConferenceManager::onTrackSubscribedQueued(QString trackSid, QString partic
                 participantStore_->setScreenShareActive(participantIdentity, true);
             }
 
+            // Planar frames go straight to the renderers' YUV textures, so
+            // the SDK is not asked to convert them to RGBA first
             livekit::VideoStream::Options videoOptions;
+            videoOptions.format = livekit::VideoBufferType::I420;
             auto videoStream = livekit::VideoStream::fromTrack(track, videoOptions);
             mediaPipeline_->setVideoStream(trackSid, videoStream);
             mediaPipeline_->startVideoStreamReader(trackSid, participantIdentity, videoStream);
@@ -433,6 +464,21 @@ void ConferenceManager::onDataReceivedQueued(QByteArray data, QString participan
     }
 }
 
+void ConferenceManager::onVideoLayerRequested(const QString& trackSid, bool visible, int width, int height)
+{
+    // This is where a subscription asks the SFU for the simulcast layer
+    // matching its views (or pauses a track nobody sees). The SDK's
+    // RemoteTrackPublication does not expose layer or dimension selection
+    // yet, so until it does the pipeline's drop/downscale is what saves the
+    // work and the request is only recorded.
+    if (visible) {
+        Logger::instance().debug(QString("Video track %1 needs at most %2x%3")
+                                .arg(trackSid).arg(width).arg(height));
+    } else {
+        Logger::instance().debug(QString("Video track %1 is not shown").arg(trackSid));
+    }
+}
+
 void ConferenceManager::updateParticipantInfo(const QString& identity)
 {
     if (!participantStore_->contains(identity)) {
@@ -5,7 +5,9 @@
 #include <QString>
 #include <QByteArray>
 #include <QImage>
+#include <QRegion>
 #include <QList>
+#include <QStringList>
 #include <memory>
 #include "conference_types.h"
 #include "room_controller.h"
@@ -31,6 +33,7 @@ public:
     
     // Media controls
     void toggleMicrophone();
+    void releaseMicrophone();
     void toggleCamera();
     void toggleScreenShare();
     void setScreenShareMode(ScreenCapturer::Mode mode, QScreen* screen, WId windowId);
@@ -38,6 +41,7 @@ public:
     // Device switching (while conference is active)
     void switchCamera(const QString& deviceId);
     void switchMicrophone(const QString& deviceId);
+    void setCameraQuality(const QString& quality);
     
     bool isMicrophoneEnabled() const;
     bool isCameraEnabled() const;
@@ -54,6 +58,9 @@ public:
     QString getRoomName() const { return roomName_; }
     QString getLocalParticipantName() const { return participantName_; }
     
+    // Identity under which the local participant appears in voice activity signals
+    static constexpr const char* kLocalSpeakerId = "local";
+    
 signals:
     // Connection events
     void connected();
@@ -80,17 +87,22 @@ signals:
     void localMicrophoneChanged(bool enabled);
     void localCameraChanged(bool enabled);
     void localScreenShareChanged(bool enabled);
-    void localScreenFrameReady(const QImage& frame);
+    void localScreenFrameReady(const QImage& frame, const QRegion& updated);
     
     // Chat events
     void chatMessageReceived(const ChatMessage& message);
     void localVideoFrameReady(const QImage& frame);
     void videoFrameReceived(const QString& participantIdentity,
                             const QString& trackSid,
-                            const QImage& frame,
+                            const links::video::I420FrameRef& frame,
                             livekit::TrackSource source);
     void audioActivity(const QString& participantIdentity, bool hasAudio);
     
+    // Voice activity: transitions only, plus a throttled (5 Hz) ranking.
+    // The local participant is reported as kLocalSpeakerId.
+    void speakingChanged(const QString& participantIdentity, bool speaking);
+    void activeSpeakersChanged(const QStringList& identities);
+    
 private:
     // Queued slots for RoomEventDelegate signals (thread-safe event handling)
     void onParticipantConnectedQueued(QString identity, QString sid, QString name);
@@ -105,6 +117,8 @@ private:
     void onTrackUnpublishedQueued(QString trackSid, QString participantIdentity, int kind, int source);
     void onConnectionStateChangedQueued(int state);
     void onDataReceivedQueued(QByteArray data, QString participantIdentity, QString topic);
+    // Simulcast layer selection for a remote video track (see MediaPipeline)
+    void onVideoLayerRequested(const QString& trackSid, bool visible, int width, int height);
     
     void updateParticipantInfo(const QString& identity);
 
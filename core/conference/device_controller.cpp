@@ -3,6 +3,7 @@
 #include "../../utils/settings.h"
 #include "livekit/local_audio_track.h"
 #include "livekit/local_video_track.h"
+#include <algorithm>
 
 DeviceController::DeviceController(livekit::Room* room, QObject* parent)
     : QObject(parent),
@@ -17,6 +18,7 @@ DeviceController::DeviceController(livekit::Room* room, QObject* parent)
     if (!cameraId.isEmpty()) {
         cameraCapturer_->setCameraById(cameraId.toUtf8());
     }
+    setCameraQuality(settings.getCameraQuality());
 
     const QString micId = settings.getSelectedMicrophoneId();
     if (!micId.isEmpty()) {
@@ -27,6 +29,35 @@ DeviceController::DeviceController(livekit::Room* room, QObject* parent)
     microphoneCapturer_->setEchoCancellationEnabled(settings.isEchoCancellationEnabled());
     microphoneCapturer_->setNoiseSuppressionEnabled(settings.isNoiseSuppressionEnabled());
     microphoneCapturer_->setAutoGainControlEnabled(settings.isAutoGainControlEnabled());
+    microphoneCapturer_->setRealtimePriorityEnabled(settings.isRealtimeAudioPriorityEnabled());
+
+    microphoneReleaseTimer_.setSingleShot(true);
+    setMicrophoneReleaseDelay(settings.getMicrophoneReleaseDelaySeconds());
+    QObject::connect(&microphoneReleaseTimer_, &QTimer::timeout, this, [this]() {
+        Logger::instance().info("Microphone idle while muted, releasing device");
+        releaseMicrophone();
+    });
+
+    cameraStandbyTimer_.setSingleShot(true);
+    setCameraStandbyTimeout(settings.getCameraStandbySeconds());
+    QObject::connect(&cameraStandbyTimer_, &QTimer::timeout, this, [this]() {
+        Logger::instance().info("Camera standby timed out, releasing device");
+        releaseCamera();
+    });
+    QObject::connect(cameraCapturer_, &CameraCapturer::firstFrameCaptured,
+                     this, &DeviceController::localCameraFirstFrame);
+
+    // Live switches finish asynchronously; a failed one leaves the old device running
+    QObject::connect(microphoneCapturer_, &MicrophoneCapturer::deviceSwitched, this, [](bool success) {
+        if (!success) {
+            Logger::instance().warning("Microphone switch failed, still using the previous device");
+        }
+    });
+    QObject::connect(cameraCapturer_, &CameraCapturer::cameraSwitched, this, [](bool success) {
+        if (!success) {
+            Logger::instance().warning("Camera switch failed, still using the previous camera");
+        }
+    });
 
     QObject::connect(cameraCapturer_, &CameraCapturer::error, this, [](const QString& msg) {
         Logger::instance().error(QString("Camera error: %1").arg(msg));
@@ -39,6 +70,8 @@ DeviceController::DeviceController(livekit::Room* room, QObject* parent)
     QObject::connect(microphoneCapturer_, &MicrophoneCapturer::error, this, [](const QString& msg) {
         Logger::instance().error(QString("Microphone error: %1").arg(msg));
     });
+    QObject::connect(microphoneCapturer_, &MicrophoneCapturer::speakingChanged,
+                     this, &DeviceController::localSpeakingChanged);
 
     QObject::connect(screenCapturer_, &ScreenCapturer::error, this, [this](const QString& msg) {
         Logger::instance().error(QString("Screen capture error: %1").arg(msg));
@@ -62,6 +95,8 @@ void DeviceController::setRoom(livekit::Room* room)
 
 void DeviceController::stopCapturers()
 {
+    microphoneReleaseTimer_.stop();
+    cameraStandbyTimer_.stop();
     if (cameraCapturer_) {
         cameraCapturer_->stop();
     }
@@ -102,6 +137,8 @@ void DeviceController::unpublishLocalTracks()
 
 void DeviceController::resetLocalState()
 {
+    microphoneReleaseTimer_.stop();
+    cameraStandbyTimer_.stop();
     localVideoTrack_ = nullptr;
     localAudioTrack_ = nullptr;
     localScreenTrack_ = nullptr;
@@ -119,43 +156,26 @@ void DeviceController::toggleMicrophone()
 
     try {
         if (microphoneEnabled_) {
-            Logger::instance().info("Starting microphone capturer...");
-            if (microphoneCapturer_->start()) {
-                Logger::instance().info("Microphone capturer started successfully");
-                auto source = microphoneCapturer_->getAudioSource();
-                Logger::instance().info(QString("Got audio source: %1").arg(source ? "valid" : "null"));
-
-                if (source) {
-                    // Always create a new audio track since AudioSource is recreated each time
-                    Logger::instance().info("Creating audio track...");
-                    localAudioTrack_ = livekit::LocalAudioTrack::createLocalAudioTrack("mic", source);
-                    Logger::instance().info(QString("Audio track created: %1")
-                        .arg(localAudioTrack_ ? "valid" : "null"));
-
-                    auto localParticipant = room_->localParticipant();
-                    Logger::instance().info(QString("Got local participant: %1")
-                        .arg(localParticipant ? "valid" : "null"));
-
-                    if (localParticipant && localAudioTrack_) {
-                        Logger::instance().info("Publishing audio track...");
-                        livekit::TrackPublishOptions options;
-                        options.source = livekit::TrackSource::SOURCE_MICROPHONE;
-                        localParticipant->publishTrack(localAudioTrack_, options);
-                        Logger::instance().info("Audio track published successfully");
-                    }
-                }
-            } else {
+            microphoneReleaseTimer_.stop();
+            if (microphoneCapturer_->isActive() && localAudioTrack_) {
+                // Warm unmute: same device, APM state, source and publication
+                microphoneCapturer_->setMuted(false);
+                localAudioTrack_->unmute();
+                Logger::instance().info("Microphone unmuted without republishing");
+            } else if (!publishMicrophone()) {
                 Logger::instance().error("Failed to start microphone");
                 microphoneEnabled_ = false;
             }
+        } else if (microphoneCapturer_->isActive() && localAudioTrack_
+                   && microphoneReleaseTimer_.interval() > 0) {
+            // Warm mute: stop sending and signal the mute, keep everything open
+            microphoneCapturer_->setMuted(true);
+            localAudioTrack_->mute();
+            microphoneReleaseTimer_.start();
+            Logger::instance().info(QString("Microphone muted, device released after %1 s idle")
+                .arg(microphoneReleaseTimer_.interval() / 1000));
         } else {
-            microphoneCapturer_->stop();
-
-            auto localParticipant = room_->localParticipant();
-            if (localParticipant && localAudioTrack_) {
-                localParticipant->unpublishTrack(localAudioTrack_->sid());
-                localAudioTrack_ = nullptr;
-            }
+            releaseMicrophone();
         }
     } catch (const std::exception& e) {
         Logger::instance().error(QString("Exception in toggleMicrophone: %1").arg(e.what()));
@@ -165,6 +185,60 @@ void DeviceController::toggleMicrophone()
     emit localMicrophoneChanged(microphoneEnabled_);
 }
 
+void DeviceController::releaseMicrophone()
+{
+    microphoneReleaseTimer_.stop();
+    if (microphoneEnabled_) {
+        Logger::instance().warning("Not releasing microphone while it is enabled");
+        return;
+    }
+
+    microphoneCapturer_->stop();
+
+    auto localParticipant = room_ ? room_->localParticipant() : nullptr;
+    if (localParticipant && localAudioTrack_) {
+        localParticipant->unpublishTrack(localAudioTrack_->sid());
+    }
+    localAudioTrack_ = nullptr;
+}
+
+void DeviceController::setMicrophoneReleaseDelay(int seconds)
+{
+    microphoneReleaseTimer_.setInterval(std::max(0, seconds) * 1000);
+}
+
+bool DeviceController::publishMicrophone()
+{
+    Logger::instance().info("Starting microphone capturer...");
+    if (!microphoneCapturer_->start()) {
+        return false;
+    }
+    Logger::instance().info("Microphone capturer started successfully");
+    auto source = microphoneCapturer_->getAudioSource();
+    Logger::instance().info(QString("Got audio source: %1").arg(source ? "valid" : "null"));
+
+    if (source) {
+        // A cold start always has a fresh AudioSource, so the track is new too
+        Logger::instance().info("Creating audio track...");
+        localAudioTrack_ = livekit::LocalAudioTrack::createLocalAudioTrack("mic", source);
+        Logger::instance().info(QString("Audio track created: %1")
+            .arg(localAudioTrack_ ? "valid" : "null"));
+
+        auto localParticipant = room_->localParticipant();
+        Logger::instance().info(QString("Got local participant: %1")
+            .arg(localParticipant ? "valid" : "null"));
+
+        if (localParticipant && localAudioTrack_) {
+            Logger::instance().info("Publishing audio track...");
+            livekit::TrackPublishOptions options;
+            options.source = livekit::TrackSource::SOURCE_MICROPHONE;
+            localParticipant->publishTrack(localAudioTrack_, options);
+            Logger::instance().info("Audio track published successfully");
+        }
+    }
+    return true;
+}
+
 void DeviceController::toggleCamera()
 {
     cameraEnabled_ = !cameraEnabled_;
@@ -172,51 +246,25 @@ void DeviceController::toggleCamera()
 
     try {
         if (cameraEnabled_) {
-            Logger::instance().info("Starting camera capturer...");
-            if (cameraCapturer_->start()) {
-                Logger::instance().info("Camera capturer started successfully");
-                auto source = cameraCapturer_->getVideoSource();
-                Logger::instance().info(QString("Got video source: %1").arg(source ? "valid" : "null"));
-
-                if (source) {
-                    if (!localVideoTrack_) {
-                        Logger::instance().info("Creating video track...");
-                        localVideoTrack_ = livekit::LocalVideoTrack::createLocalVideoTrack("camera", source);
-                        Logger::instance().info(QString("Video track created: %1")
-                            .arg(localVideoTrack_ ? "valid" : "null"));
-                    }
-
-                    auto localParticipant = room_->localParticipant();
-                    Logger::instance().info(QString("Got local participant: %1")
-                        .arg(localParticipant ? "valid" : "null"));
-
-                    if (localParticipant && localVideoTrack_) {
-                        Logger::instance().info("Publishing video track...");
-                        livekit::TrackPublishOptions options;
-                        options.source = livekit::TrackSource::SOURCE_CAMERA;
-                        auto publication = localParticipant->publishTrack(localVideoTrack_, options);
-                        if (publication) {
-                            cameraTrackSid_ = publication->sid();
-                            Logger::instance().info(QString("Video track published with SID: %1")
-                                .arg(QString::fromStdString(cameraTrackSid_)));
-                        }
-                    }
-                }
-            } else {
+            cameraStandbyTimer_.stop();
+            if (cameraCapturer_->isStandby() && localVideoTrack_) {
+                // Warm resume: the session is still open, only frames restart
+                cameraCapturer_->resume();
+                localVideoTrack_->unmute();
+                Logger::instance().info("Camera resumed from standby without republishing");
+            } else if (!publishCamera()) {
                 Logger::instance().error("Failed to start camera");
                 cameraEnabled_ = false;
             }
+        } else if (cameraCapturer_->isActive() && localVideoTrack_
+                   && cameraStandbyTimer_.interval() > 0) {
+            cameraCapturer_->enterStandby();
+            localVideoTrack_->mute();
+            cameraStandbyTimer_.start();
+            Logger::instance().info(QString("Camera in standby, released after %1 s")
+                .arg(cameraStandbyTimer_.interval() / 1000));
         } else {
-            cameraCapturer_->stop();
-
-            auto localParticipant = room_->localParticipant();
-            if (localParticipant && !cameraTrackSid_.empty()) {
-                Logger::instance().info(QString("Unpublishing camera track: %1")
-                    .arg(QString::fromStdString(cameraTrackSid_)));
-                localParticipant->unpublishTrack(cameraTrackSid_);
-                cameraTrackSid_.clear();
-                localVideoTrack_ = nullptr;
-            }
+            releaseCamera();
         }
     } catch (const std::exception& e) {
         Logger::instance().error(QString("Exception in toggleCamera: %1").arg(e.what()));
@@ -226,6 +274,77 @@ void DeviceController::toggleCamera()
     emit localCameraChanged(cameraEnabled_);
 }
 
+void DeviceController::releaseCamera()
+{
+    cameraStandbyTimer_.stop();
+    if (cameraEnabled_) {
+        Logger::instance().warning("Not releasing camera while it is enabled");
+        return;
+    }
+
+    cameraCapturer_->stop();
+
+    auto localParticipant = room_ ? room_->localParticipant() : nullptr;
+    if (localParticipant && !cameraTrackSid_.empty()) {
+        Logger::instance().info(QString("Unpublishing camera track: %1")
+            .arg(QString::fromStdString(cameraTrackSid_)));
+        localParticipant->unpublishTrack(cameraTrackSid_);
+    }
+    cameraTrackSid_.clear();
+    localVideoTrack_ = nullptr;
+}
+
+void DeviceController::setCameraStandbyTimeout(int seconds)
+{
+    cameraStandbyTimer_.setInterval(std::max(0, seconds) * 1000);
+}
+
+void DeviceController::setCameraQuality(const QString& quality)
+{
+    links::video::CameraQuality parsed = links::video::CameraQuality::Standard;
+    if (!links::video::parseQuality(quality.toStdString(), &parsed)) {
+        Logger::instance().warning(QString("Unknown camera quality '%1', using standard").arg(quality));
+    }
+    cameraCapturer_->setQuality(parsed);
+}
+
+bool DeviceController::publishCamera()
+{
+    Logger::instance().info("Starting camera capturer...");
+    if (!cameraCapturer_->start()) {
+        return false;
+    }
+    Logger::instance().info("Camera capturer started successfully");
+    auto source = cameraCapturer_->getVideoSource();
+    Logger::instance().info(QString("Got video source: %1").arg(source ? "valid" : "null"));
+
+    if (source) {
+        if (!localVideoTrack_) {
+            Logger::instance().info("Creating video track...");
+            localVideoTrack_ = livekit::LocalVideoTrack::createLocalVideoTrack("camera", source);
+            Logger::instance().info(QString("Video track created: %1")
+                .arg(localVideoTrack_ ? "valid" : "null"));
+        }
+
+        auto localParticipant = room_->localParticipant();
+        Logger::instance().info(QString("Got local participant: %1")
+            .arg(localParticipant ? "valid" : "null"));
+
+        if (localParticipant && localVideoTrack_) {
+            Logger::instance().info("Publishing video track...");
+            livekit::TrackPublishOptions options;
+            options.source = livekit::TrackSource::SOURCE_CAMERA;
+            auto publication = localParticipant->publishTrack(localVideoTrack_, options);
+            if (publication) {
+                cameraTrackSid_ = publication->sid();
+                Logger::instance().info(QString("Video track published with SID: %1")
+                    .arg(QString::fromStdString(cameraTrackSid_)));
+            }
+        }
+    }
+    return true;
+}
+
 void DeviceController::toggleScreenShare()
 {
     if (screenShareDebounceTimer_.isValid()
@@ -304,39 +423,12 @@ void DeviceController::switchCamera(const QString& deviceId)
     Logger::instance().info(QString("Switching camera to device: %1").arg(deviceId));
 
     try {
-        const bool wasEnabled = cameraEnabled_;
-
-        if (cameraEnabled_) {
-            cameraCapturer_->stop();
-
-            auto localParticipant = room_->localParticipant();
-            if (localParticipant && localVideoTrack_) {
-                localParticipant->unpublishTrack(localVideoTrack_->sid());
-                localVideoTrack_ = nullptr;
-            }
-        }
-
-        cameraCapturer_->setCameraById(deviceId.toUtf8());
-
-        if (wasEnabled) {
-            if (cameraCapturer_->start()) {
-                auto source = cameraCapturer_->getVideoSource();
-                if (source) {
-                    localVideoTrack_ = livekit::LocalVideoTrack::createLocalVideoTrack("camera", source);
-
-                    auto localParticipant = room_->localParticipant();
-                    if (localParticipant && localVideoTrack_) {
-                        livekit::TrackPublishOptions options;
-                        options.source = livekit::TrackSource::SOURCE_CAMERA;
-                        localParticipant->publishTrack(localVideoTrack_, options);
-                        Logger::instance().info("Camera switched and republished successfully");
-                    }
-                }
-            } else {
-                Logger::instance().error("Failed to restart camera with new device");
-                cameraEnabled_ = false;
-                emit localCameraChanged(cameraEnabled_);
-            }
+        // An open camera (live or in standby) is switched in place: the new
+        // device is brought up next to the old one and the VideoSource and
+        // published track are kept
+        if (!cameraCapturer_->switchCamera(deviceId.toUtf8())) {
+            Logger::instance().error("Failed to open the new camera, keeping the current one");
+            return;
         }
 
         Settings::instance().setSelectedCameraId(deviceId);
@@ -352,39 +444,11 @@ void DeviceController::switchMicrophone(const QString& deviceId)
     Logger::instance().info(QString("Switching microphone to device: %1").arg(deviceId));
 
     try {
-        const bool wasEnabled = microphoneEnabled_;
-
-        if (microphoneEnabled_) {
-            microphoneCapturer_->stop();
-
-            auto localParticipant = room_->localParticipant();
-            if (localParticipant && localAudioTrack_) {
-                localParticipant->unpublishTrack(localAudioTrack_->sid());
-                localAudioTrack_ = nullptr;
-            }
-        }
-
-        microphoneCapturer_->setDeviceById(deviceId.toUtf8());
-
-        if (wasEnabled) {
-            if (microphoneCapturer_->start()) {
-                auto source = microphoneCapturer_->getAudioSource();
-                if (source) {
-                    localAudioTrack_ = livekit::LocalAudioTrack::createLocalAudioTrack("mic", source);
-
-                    auto localParticipant = room_->localParticipant();
-                    if (localParticipant && localAudioTrack_) {
-                        livekit::TrackPublishOptions options;
-                        options.source = livekit::TrackSource::SOURCE_MICROPHONE;
-                        localParticipant->publishTrack(localAudioTrack_, options);
-                        Logger::instance().info("Microphone switched and republished successfully");
-                    }
-                }
-            } else {
-                Logger::instance().error("Failed to restart microphone with new device");
-                microphoneEnabled_ = false;
-                emit localMicrophoneChanged(microphoneEnabled_);
-            }
+        // An open microphone (live or warm-muted) is switched in place with a
+        // short crossfade; the AudioSource and published track are kept
+        if (!microphoneCapturer_->switchDevice(deviceId.toUtf8())) {
+            Logger::instance().error("Failed to open the new microphone, keeping the current one");
+            return;
         }
 
         Settings::instance().setSelectedMicrophoneId(deviceId);
@@ -402,7 +466,7 @@ void DeviceController::connectScreenSignals()
         QObject::disconnect(screenConn);
     }
     screenConn = QObject::connect(screenCapturer_, &ScreenCapturer::frameCaptured,
-                                  this, [this](const QImage& frame) {
-                                      emit localScreenFrameReady(frame);
+                                  this, [this](const QImage& frame, const QRegion& updated) {
+                                      emit localScreenFrameReady(frame, updated);
                                   });
 }
@@ -4,10 +4,14 @@
 #include <QElapsedTimer>
 #include <QObject>
 #include <QImage>
+#include <QRegion>
 #include <QString>
+#include <QTimer>
 #include <memory>
 #include <string>
 #include "livekit/livekit.h"
+#include "livekit/local_audio_track.h"
+#include "livekit/local_video_track.h"
 #include "../camera_capturer.h"
 #include "../microphone_capturer.h"
 #include "../screen_capturer.h"
@@ -23,8 +27,19 @@ public:
     void unpublishLocalTracks();
     void resetLocalState();
 
+    // Muting keeps the device, APM and published track alive (warm mute);
+    // the device is released after the configured idle period
     void toggleMicrophone();
+    // Closes a warm-muted microphone and unpublishes its track now
+    void releaseMicrophone();
+    void setMicrophoneReleaseDelay(int seconds);
+    // Turning the camera off keeps the session open in standby (track
+    // muted, frames dropped) until the standby timeout releases it
     void toggleCamera();
+    void releaseCamera();
+    void setCameraStandbyTimeout(int seconds);
+    // "low" / "standard" / "high"; renegotiates a running camera's mode
+    void setCameraQuality(const QString& quality);
     void toggleScreenShare();
     void setScreenShareMode(ScreenCapturer::Mode mode, QScreen* screen, WId windowId);
     void switchCamera(const QString& deviceId);
@@ -34,23 +49,38 @@ public:
     bool isCameraEnabled() const { return cameraEnabled_; }
     bool isScreenSharing() const { return screenShareEnabled_; }
 
+    // Capture-side APM; the playback path feeds it the echo reference
+    AudioProcessingModule* audioProcessingModule() const {
+        return microphoneCapturer_->audioProcessingModule();
+    }
+
+    // Speaking detector on the local microphone (post-APM)
+    std::shared_ptr<const links::audio::VoiceActivityDetector> localVoiceActivity() const {
+        return microphoneCapturer_->voiceActivity();
+    }
+
 signals:
     void localMicrophoneChanged(bool enabled);
+    void localSpeakingChanged(bool speaking);
     void localCameraChanged(bool enabled);
+    void localCameraFirstFrame(qint64 latencyMs, bool fromStandby);
     void localScreenShareChanged(bool enabled);
     void localVideoFrameReady(const QImage& frame);
-    void localScreenFrameReady(const QImage& frame);
+    // |updated| is what changed since the previous frame (empty: nothing)
+    void localScreenFrameReady(const QImage& frame, const QRegion& updated);
 
 private:
     void connectScreenSignals();
+    bool publishMicrophone();
+    bool publishCamera();
     livekit::Room* room() const { return room_; }
 
     livekit::Room* room_{nullptr};
     CameraCapturer* cameraCapturer_{nullptr};
     MicrophoneCapturer* microphoneCapturer_{nullptr};
     ScreenCapturer* screenCapturer_{nullptr};
-    std::shared_ptr<livekit::Track> localVideoTrack_;
-    std::shared_ptr<livekit::Track> localAudioTrack_;
+    std::shared_ptr<livekit::LocalVideoTrack> localVideoTrack_;
+    std::shared_ptr<livekit::LocalAudioTrack> localAudioTrack_;
     std::shared_ptr<livekit::Track> localScreenTrack_;
     std::string screenTrackSid_;
     std::string cameraTrackSid_;
@@ -59,6 +89,11 @@ private:
     bool microphoneEnabled_{false};
     bool screenShareEnabled_{false};
 
+    // Releases a warm-muted microphone once it has been idle long enough
+    QTimer microphoneReleaseTimer_;
+    // Releases a camera left in standby
+    QTimer cameraStandbyTimer_;
+
     QElapsedTimer screenShareDebounceTimer_;
     static constexpr int kScreenShareDebounceMs = 500;
 };
@@ -1,23 +1,73 @@
 #include "media_pipeline.h"
 #include "participant_store.h"
 #include "../../utils/logger.h"
-#include <QByteArray>
+#include "../../utils/settings.h"
+#include <QAudioDevice>
+#include <QAudioFormat>
+#include <QMediaDevices>
+#include <QHash>
 #include <QMetaObject>
+#include <algorithm>
 #include <cstdint>
 
+namespace {
+
+// Output buffer handed to the sink; bounds playout latency
+constexpr int kOutputBufferMs = 40;
+
+// Active-speaker ranking rate (5 Hz), and how much louder (in level units,
+// 0.1 == 6 dB) another speaker must be to take the first place
+constexpr int kSpeakerRankingIntervalMs = 200;
+constexpr float kSpeakerSwitchMargin = 0.1f;
+
+// A track no view shows still passes one frame per interval: the UI learns
+// from frames which streams a participant has before it creates their views
+constexpr int kHiddenFrameIntervalMs = 1000;
+
+// Executor queue of a remote audio track, in 10 ms frames. Video drops stale
+// frames at the executor's default depth; a dropped audio frame is an
+// audible gap, so audio may fall twice the jitter buffer's largest target
+// behind before anything is dropped here.
+constexpr size_t kAudioQueuedFrames = 50;
+
+// voiceActivity_ key of the local microphone; track sids never collide with it
+const QString kLocalVoiceActivityKey = QStringLiteral("local-microphone");
+
+}  // namespace
+
 MediaPipeline::MediaPipeline(ParticipantStore* participantStore, QObject* parent)
     : QObject(parent),
-      participantStore_(participantStore)
+      participantStore_(participantStore),
+      playbackWorker_(new links::audio::AudioPlaybackWorker()),
+      trackExecutor_(std::make_unique<links::media::TrackExecutor>())
 {
+    playbackThread_.setObjectName("AudioPlayback");
+    playbackWorker_->moveToThread(&playbackThread_);
+    QObject::connect(playbackWorker_, &links::audio::AudioPlaybackWorker::error, this,
+                     [](const QString& msg) {
+                         Logger::instance().error(QString("Audio playback error: %1").arg(msg));
+                     });
+
+    speakerRankingTimer_.setInterval(kSpeakerRankingIntervalMs);
+    QObject::connect(&speakerRankingTimer_, &QTimer::timeout, this, &MediaPipeline::updateActiveSpeakers);
+
+    Logger::instance().info(QString("Remote track executor started with %1 threads")
+                           .arg(trackExecutor_->threadCount()));
 }
 
 MediaPipeline::~MediaPipeline()
 {
     if (!videoStreams_.isEmpty() || !audioStreams_.isEmpty()
         || !videoStreamThreads_.empty() || !audioStreamThreads_.empty()
-        || !streamStopFlags_.isEmpty() || !audioPlayers_.isEmpty()) {
+        || !videoMailboxes_.empty()
+        || !streamStopFlags_.isEmpty() || audioOutputActive_) {
         stopAll();
     }
+    if (playbackThread_.isRunning()) {
+        playbackThread_.quit();
+        playbackThread_.wait();
+    }
+    delete playbackWorker_;
 }
 
 void MediaPipeline::setVideoStream(const QString& trackSid,
@@ -59,17 +109,43 @@ void MediaPipeline::startVideoStreamReader(const QString& trackSid,
     auto* stopFlag = new std::atomic<bool>(false);
     streamStopFlags_[trackSid] = stopFlag;
 
-    std::thread readerThread([this, trackSid, participantIdentity, stream, stopFlag]() {
+    auto mailbox = std::make_shared<VideoMailbox>();
+    videoMailboxes_[trackSid] = mailbox;
+
+    auto view = std::make_shared<VideoTrackView>();
+    view->participant = participantIdentity.toStdString();
+    if (participantStore_ && participantStore_->hasTrackSource(trackSid)
+        && participantStore_->trackSource(trackSid) == livekit::TrackSource::SOURCE_SCREENSHARE) {
+        view->source = links::video::VideoViewSource::Screen;
+    }
+    videoTrackViews_[trackSid] = view;
+
+    const std::string executorKey = trackSid.toStdString();
+    trackExecutor_->addTrack(executorKey);
+
+    // The SDK's read() blocks, so each stream keeps a reader thread, but it
+    // only hands frames to the shared executor; per-frame work runs there
+    std::thread readerThread([this, trackSid, participantIdentity, stream, stopFlag, mailbox, view, executorKey]() {
         livekit::VideoFrameEvent event;
         while (!stopFlag->load()) {
             if (!stream->read(event)) {
                 break;
             }
 
-            QMetaObject::invokeMethod(this, [this, event = std::move(event), trackSid, participantIdentity]() mutable {
-                handleVideoFrame(event, trackSid, participantIdentity);
-            }, Qt::QueuedConnection);
+            auto frame = std::make_shared<livekit::VideoFrameEvent>(std::move(event));
+            trackExecutor_->post(executorKey, [this, trackSid, participantIdentity, mailbox, view, frame]() {
+                links::video::I420FrameRef prepared = prepareVideoFrame(trackSid, frame, view.get());
+                if (!prepared) {
+                    return;
+                }
+                if (mailbox->post(std::move(prepared))) {
+                    QMetaObject::invokeMethod(this, [this, trackSid, participantIdentity, mailbox]() {
+                        deliverVideoFrame(trackSid, participantIdentity, mailbox);
+                    }, Qt::QueuedConnection);
+                }
+            });
         }
+        trackExecutor_->removeTrack(executorKey);
     });
 
     videoStreamThreads_[trackSid] = std::make_unique<std::thread>(std::move(readerThread));
@@ -79,19 +155,74 @@ void MediaPipeline::startAudioStreamReader(const QString& trackSid,
                                            const QString& participantIdentity,
                                            std::shared_ptr<livekit::AudioStream> stream)
 {
+    if (!ensureAudioOutput()) {
+        Logger::instance().warning("Audio output device unavailable");
+        return;
+    }
+
     auto* stopFlag = new std::atomic<bool>(false);
     streamStopFlags_[trackSid] = stopFlag;
 
-    std::thread readerThread([this, trackSid, participantIdentity, stream, stopFlag]() {
+    // Frames go from the reader thread through the shared executor into the
+    // track's mixer queue
+    auto track = audioMixer_->addTrack(trackSid.toStdString());
+    const std::string executorKey = trackSid.toStdString();
+    trackExecutor_->addTrack(executorKey, kAudioQueuedFrames);
+
+    auto detector = std::make_shared<links::audio::VoiceActivityDetector>();
+    voiceActivity_[trackSid] = {participantIdentity, detector};
+    speakerRankingTimer_.start();
+
+    // Only the start and end of the stream and speaking transitions are
+    // reported (queued) to the GUI thread
+    std::thread readerThread([this, trackSid, participantIdentity, stream, stopFlag, track, detector, executorKey]() {
+        const auto notifySpeaking = [this, participantIdentity]() {
+            QMetaObject::invokeMethod(this, [this, participantIdentity]() {
+                updateSpeakingState(participantIdentity);
+            }, Qt::QueuedConnection);
+        };
+
         livekit::AudioFrameEvent event;
+        bool announced = false;
         while (!stopFlag->load()) {
             if (!stream->read(event)) {
                 break;
             }
 
-            QMetaObject::invokeMethod(this, [this, event = std::move(event), trackSid, participantIdentity]() mutable {
-                handleAudioFrame(event, trackSid, participantIdentity);
-            }, Qt::QueuedConnection);
+            // Resampling into the mixer and speech detection run on the pool
+            auto frameEvent = std::make_shared<livekit::AudioFrameEvent>(std::move(event));
+            trackExecutor_->post(executorKey, [frameEvent, track, detector, notifySpeaking]() {
+                const auto& frame = frameEvent->frame;
+                track->push(frame.data().data(), static_cast<size_t>(frame.samples_per_channel()),
+                            frame.sample_rate(), frame.num_channels());
+
+                if (detector->process(frame.data().data(), static_cast<size_t>(frame.samples_per_channel()),
+                                      frame.sample_rate(), frame.num_channels())) {
+                    notifySpeaking();
+                }
+            });
+
+            if (!announced) {
+                announced = true;
+                emit audioActivity(participantIdentity, true);
+            }
+        }
+        // Drops only happen in post(), and this thread is the only poster
+        const links::media::TrackExecutorStats executorStats = trackExecutor_->trackStats(executorKey);
+        if (executorStats.dropped > 0) {
+            Logger::instance().warning(QString("Audio track %1: %2 of %3 frames dropped before the mixer "
+                                               "(executor backlog)")
+                                      .arg(trackSid)
+                                      .arg(executorStats.dropped)
+                                      .arg(executorStats.executed + executorStats.dropped));
+        }
+        // No task touches the detector once the track is gone from the pool
+        trackExecutor_->removeTrack(executorKey);
+        if (detector->reset()) {
+            notifySpeaking();
+        }
+        if (announced) {
+            emit audioActivity(participantIdentity, false);
         }
     });
 
@@ -101,6 +232,8 @@ void MediaPipeline::startAudioStreamReader(const QString& trackSid,
 void MediaPipeline::stopTrack(const QString& trackSid)
 {
     stopStreamReaders(trackSid);
+    trackExecutor_->removeTrack(trackSid.toStdString());
+    removeVideoMailbox(trackSid);
 
     if (videoStreams_.contains(trackSid)) {
         videoStreams_.remove(trackSid);
@@ -108,12 +241,23 @@ void MediaPipeline::stopTrack(const QString& trackSid)
     if (audioStreams_.contains(trackSid)) {
         audioStreams_.remove(trackSid);
     }
-    if (audioPlayers_.contains(trackSid)) {
-        auto player = audioPlayers_.take(trackSid);
-        if (player.sink) {
-            player.sink->stop();
+    if (audioMixer_) {
+        if (auto track = audioMixer_->track(trackSid.toStdString())) {
+            const auto stats = track->stats();
+            Logger::instance().info(QString("Audio track %1 playout: target %2 ms, delay %3 ms, jitter %4 ms, "
+                                            "underruns %5, concealed %6 ms, accelerated %7 ms, expanded %8 ms")
+                                   .arg(trackSid)
+                                   .arg(stats.targetDelayMs, 0, 'f', 1)
+                                   .arg(stats.currentDelayMs, 0, 'f', 1)
+                                   .arg(stats.jitterMs, 0, 'f', 1)
+                                   .arg(stats.underruns)
+                                   .arg(stats.concealedMs, 0, 'f', 0)
+                                   .arg(stats.acceleratedMs, 0, 'f', 0)
+                                   .arg(stats.expandedMs, 0, 'f', 0));
         }
+        audioMixer_->removeTrack(trackSid.toStdString());
     }
+    removeVoiceActivity(trackSid);
 }
 
 void MediaPipeline::stopAll()
@@ -131,6 +275,10 @@ void MediaPipeline::stopAll()
     }
     videoStreamThreads_.clear();
 
+    while (!videoMailboxes_.empty()) {
+        removeVideoMailbox(videoMailboxes_.begin()->first);
+    }
+
     for (auto& [trackSid, threadPtr] : audioStreamThreads_) {
         if (threadPtr && threadPtr->joinable()) {
             threadPtr->join();
@@ -149,87 +297,319 @@ void MediaPipeline::stopAll()
     Logger::instance().info("Cleaning up audio streams");
     audioStreams_.clear();
 
-    for (auto& player : audioPlayers_) {
-        if (player.sink) {
-            player.sink->stop();
+    QStringList remoteKeys;
+    for (const auto& [key, entry] : voiceActivity_) {
+        if (key != kLocalVoiceActivityKey) {
+            remoteKeys.append(key);
         }
     }
-    audioPlayers_.clear();
+    for (const QString& key : remoteKeys) {
+        removeVoiceActivity(key);
+    }
+
+    stopAudioOutput();
 }
 
-void MediaPipeline::handleVideoFrame(const livekit::VideoFrameEvent& event,
-                                     const QString& trackSid,
-                                     const QString& participantIdentity)
+void MediaPipeline::setAudioTrackVolume(const QString& trackSid, float volume)
 {
-    const auto& frame = event.frame;
-    if (frame.width() == 0 || frame.height() == 0) {
-        return;
+    if (audioMixer_) {
+        audioMixer_->setTrackGain(trackSid.toStdString(), volume);
     }
+}
 
-    livekit::TrackSource source = livekit::TrackSource::SOURCE_UNKNOWN;
-    if (participantStore_ && participantStore_->hasTrackSource(trackSid)) {
-        source = participantStore_->trackSource(trackSid);
+void MediaPipeline::setAudioTrackMuted(const QString& trackSid, bool muted)
+{
+    if (audioMixer_) {
+        audioMixer_->setTrackMuted(trackSid.toStdString(), muted);
     }
-    if (source == livekit::TrackSource::SOURCE_SCREENSHARE && participantStore_) {
-        participantStore_->setScreenShareActive(participantIdentity, true);
+}
+
+links::audio::JitterBufferStats MediaPipeline::audioTrackStatistics(const QString& trackSid) const
+{
+    if (audioMixer_) {
+        if (auto track = audioMixer_->track(trackSid.toStdString())) {
+            return track->stats();
+        }
     }
+    return {};
+}
 
-    QImage image(frame.data(), frame.width(), frame.height(), QImage::Format_RGBA8888);
-    QImage imageCopy = image.copy();
+links::video::FrameMailboxStats MediaPipeline::videoTrackStatistics(const QString& trackSid) const
+{
+    const auto it = videoMailboxes_.find(trackSid);
+    return it != videoMailboxes_.end() ? it->second->stats() : links::video::FrameMailboxStats();
+}
 
-    emit videoFrameReady(participantIdentity, trackSid, imageCopy, source);
+MediaPipeline::VideoViewStats MediaPipeline::videoViewStatistics(const QString& trackSid) const
+{
+    VideoViewStats stats;
+    const auto it = videoTrackViews_.find(trackSid);
+    if (it != videoTrackViews_.end()) {
+        stats.hidden = it->second->hidden.load(std::memory_order_relaxed);
+        stats.downscaled = it->second->downscaled.load(std::memory_order_relaxed);
+    }
+    return stats;
 }
 
-void MediaPipeline::handleAudioFrame(const livekit::AudioFrameEvent& event,
-                                     const QString& trackSid,
-                                     const QString& participantIdentity)
+void MediaPipeline::setEchoCanceller(AudioProcessingModule* apm)
 {
-    const auto& frame = event.frame;
+    renderTap_.setProcessor(apm);
+}
 
-    emit audioActivity(participantIdentity, true);
+void MediaPipeline::setLocalVoiceActivity(const QString& identity,
+                                          std::shared_ptr<const links::audio::VoiceActivityDetector> detector)
+{
+    removeVoiceActivity(kLocalVoiceActivityKey);
+    if (!detector) {
+        return;
+    }
+    voiceActivity_[kLocalVoiceActivityKey] = {identity, std::move(detector)};
+    speakerRankingTimer_.start();
+    updateSpeakingState(identity);
+}
 
-    auto playbackIt = audioPlayers_.find(trackSid);
-    if (playbackIt == audioPlayers_.end()) {
-        playbackIt = audioPlayers_.insert(trackSid, AudioPlayback{});
+void MediaPipeline::updateSpeakingState(const QString& identity)
+{
+    // A participant speaks if any of their tracks (microphone, screen share
+    // audio) does
+    bool speaking = false;
+    for (const auto& [key, entry] : voiceActivity_) {
+        if (entry.identity == identity && entry.detector->isSpeaking()) {
+            speaking = true;
+            break;
+        }
+    }
+    if (speaking == speakingIdentities_.contains(identity)) {
+        return;
     }
 
-    AudioPlayback& playback = playbackIt.value();
+    if (speaking) {
+        speakingIdentities_.insert(identity);
+    } else {
+        speakingIdentities_.remove(identity);
+    }
+    emit speakingChanged(identity, speaking);
+}
 
-    bool needRecreate = !playback.sink
-        || playback.format.sampleRate() != frame.sample_rate()
-        || playback.format.channelCount() != frame.num_channels();
+void MediaPipeline::removeVoiceActivity(const QString& key)
+{
+    const auto it = voiceActivity_.find(key);
+    if (it == voiceActivity_.end()) {
+        return;
+    }
+    const QString identity = it->second.identity;
+    voiceActivity_.erase(it);
+    updateSpeakingState(identity);
 
-    if (needRecreate) {
-        if (playback.sink) {
-            playback.sink->stop();
+    if (voiceActivity_.empty()) {
+        speakerRankingTimer_.stop();
+        updateActiveSpeakers();
+    }
+}
+
+void MediaPipeline::updateActiveSpeakers()
+{
+    QHash<QString, float> levels;
+    for (const auto& [key, entry] : voiceActivity_) {
+        if (entry.detector->isSpeaking()) {
+            levels[entry.identity] = std::max(levels.value(entry.identity, 0.0f), entry.detector->level());
         }
+    }
 
-        QAudioFormat format;
-        format.setSampleRate(frame.sample_rate());
-        format.setChannelCount(frame.num_channels());
-        format.setSampleFormat(QAudioFormat::Int16);
+    QStringList ranked = levels.keys();
+    std::sort(ranked.begin(), ranked.end(), [&levels](const QString& a, const QString& b) {
+        const float levelA = levels.value(a);
+        const float levelB = levels.value(b);
+        return levelA != levelB ? levelA > levelB : a < b;
+    });
 
-        QAudioDevice device = QMediaDevices::defaultAudioOutput();
-        if (!device.isFormatSupported(format)) {
-            Logger::instance().warning("Audio format not supported by output device, using preferred format");
-            format = device.preferredFormat();
-            format.setSampleFormat(QAudioFormat::Int16);
+    // Keep the current top speaker first unless someone is clearly louder, so
+    // speaker-follow layouts do not flip between two people talking at once
+    if (ranked.size() > 1 && !activeSpeakers_.isEmpty()) {
+        const QString& previous = activeSpeakers_.first();
+        if (levels.contains(previous) && ranked.first() != previous
+            && levels.value(ranked.first()) - levels.value(previous) < kSpeakerSwitchMargin) {
+            ranked.removeOne(previous);
+            ranked.prepend(previous);
         }
+    }
+
+    if (ranked != activeSpeakers_) {
+        activeSpeakers_ = ranked;
+        emit activeSpeakersChanged(activeSpeakers_);
+    }
+}
+
+void MediaPipeline::deliverVideoFrame(const QString& trackSid,
+                                      const QString& participantIdentity,
+                                      const std::shared_ptr<VideoMailbox>& mailbox)
+{
+    // Deliveries still queued for a stopped (or restarted) track are stale
+    const auto it = videoMailboxes_.find(trackSid);
+    if (it == videoMailboxes_.end() || it->second != mailbox) {
+        return;
+    }
 
-        playback.format = format;
-        playback.sink = QSharedPointer<QAudioSink>::create(device, format);
-        playback.device = playback.sink ? playback.sink->start() : nullptr;
+    links::video::I420FrameRef frame;
+    if (mailbox->take(&frame)) {
+        handleVideoFrame(frame, trackSid, participantIdentity);
     }
+}
 
-    if (!playback.device) {
-        Logger::instance().warning("Audio output device unavailable");
+void MediaPipeline::removeVideoMailbox(const QString& trackSid)
+{
+    const auto it = videoMailboxes_.find(trackSid);
+    if (it == videoMailboxes_.end()) {
         return;
     }
+    const auto stats = it->second->stats();
+    const VideoViewStats viewStats = videoViewStatistics(trackSid);
+    Logger::instance().info(QString("Video track %1 delivery: received %2, delivered %3, dropped %4, "
+                                    "hidden %5, downscaled %6")
+                           .arg(trackSid)
+                           .arg(stats.received)
+                           .arg(stats.delivered)
+                           .arg(stats.dropped)
+                           .arg(viewStats.hidden)
+                           .arg(viewStats.downscaled));
+    videoMailboxes_.erase(it);
+    videoTrackViews_.erase(trackSid);
+}
+
+links::video::I420FrameRef MediaPipeline::prepareVideoFrame(const QString& trackSid,
+                                                            std::shared_ptr<livekit::VideoFrameEvent> frame,
+                                                            VideoTrackView* view)
+{
+    const int width = frame->frame.width();
+    const int height = frame->frame.height();
+    if (width == 0 || height == 0) {
+        return nullptr;
+    }
+    if (frame->frame.type() != livekit::VideoBufferType::I420) {
+        if (!view->formatWarned) {
+            view->formatWarned = true;
+            Logger::instance().warning(QString("Video track %1 delivers non-I420 frames, dropping them")
+                                      .arg(trackSid));
+        }
+        return nullptr;
+    }
+
+    // The registry is only queried again after the UI changed something
+    auto& registry = links::video::VideoViewRegistry::instance();
+    const uint64_t generation = registry.generation();
+    if (generation != view->generation) {
+        view->generation = generation;
+        view->demand = registry.demand(view->participant, view->source);
+    }
+    if (!view->layerRequested || view->demand != view->requested) {
+        view->layerRequested = true;
+        view->requested = view->demand;
+        emit videoLayerRequested(trackSid, view->demand.visible, view->demand.width, view->demand.height);
+    }
+
+    if (!view->demand.visible) {
+        const auto now = std::chrono::steady_clock::now();
+        if (view->delivered && now - view->lastHiddenFrame < std::chrono::milliseconds(kHiddenFrameIntervalMs)) {
+            view->hidden.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        view->lastHiddenFrame = now;
+    }
+    view->delivered = true;
+
+    // The frame borrows the SDK's I420 buffer instead of copying it; the
+    // event is released with the last reference (usually the renderer's),
+    // on whichever thread that happens
+    const uint8_t* pixels = frame->frame.data();
+    links::video::I420FrameRef prepared = links::video::I420Frame::wrap(width, height, pixels, std::move(frame));
+
+    // Every view of this track is at most half the frame: halve it here so
+    // the GUI thread and the renderer only handle what is displayed
+    const int steps = links::video::downscaleSteps(width, height, view->demand);
+    for (int step = 0; step < steps && prepared; ++step) {
+        prepared = links::video::I420Frame::halved(*prepared);
+    }
+    if (steps > 0) {
+        view->downscaled.fetch_add(1, std::memory_order_relaxed);
+    }
+    return prepared;
+}
 
-    const auto& samples = frame.data();
-    QByteArray data(reinterpret_cast<const char*>(samples.data()),
-                    static_cast<int>(samples.size() * sizeof(int16_t)));
-    playback.device->write(data);
+void MediaPipeline::handleVideoFrame(const links::video::I420FrameRef& frame,
+                                     const QString& trackSid,
+                                     const QString& participantIdentity)
+{
+    livekit::TrackSource source = livekit::TrackSource::SOURCE_UNKNOWN;
+    if (participantStore_ && participantStore_->hasTrackSource(trackSid)) {
+        source = participantStore_->trackSource(trackSid);
+    }
+    if (source == livekit::TrackSource::SOURCE_SCREENSHARE && participantStore_) {
+        participantStore_->setScreenShareActive(participantIdentity, true);
+    }
+
+    emit videoFrameReady(participantIdentity, trackSid, frame, source);
+}
+
+bool MediaPipeline::ensureAudioOutput()
+{
+    if (audioOutputActive_) {
+        return true;
+    }
+
+    QAudioFormat format;
+    format.setSampleRate(48000);
+    format.setChannelCount(2);
+    format.setSampleFormat(QAudioFormat::Int16);
+
+    QAudioDevice device = QMediaDevices::defaultAudioOutput();
+    if (device.isNull()) {
+        return false;
+    }
+    if (!device.isFormatSupported(format)) {
+        Logger::instance().warning("Audio format not supported by output device, using preferred format");
+        format = device.preferredFormat();
+        format.setSampleFormat(QAudioFormat::Int16);
+    }
+
+    // Tracks are resampled to the device format inside the mixer, so the sink
+    // is opened once and never recreated when a remote track changes format
+    audioMixer_ = std::make_unique<links::audio::AudioMixer>(format.sampleRate(), format.channelCount());
+
+    if (!playbackThread_.isRunning()) {
+        playbackThread_.start(Settings::instance().isRealtimeAudioPriorityEnabled()
+                                  ? QThread::TimeCriticalPriority
+                                  : QThread::InheritPriority);
+    }
+
+    // The sink is created and pulled on the playback thread; wait for the result
+    bool started = false;
+    links::audio::AudioMixer* mixer = audioMixer_.get();
+    QMetaObject::invokeMethod(playbackWorker_, [this, &started, device, format, mixer]() {
+        started = playbackWorker_->start(device, format, mixer, kOutputBufferMs, &renderTap_);
+    }, Qt::BlockingQueuedConnection);
+
+    if (!started) {
+        audioMixer_.reset();
+        return false;
+    }
+
+    audioOutputActive_ = true;
+    Logger::instance().info(QString("Audio mixer output started on playback thread (rate: %1, channels: %2, echo reference: %3)")
+                           .arg(format.sampleRate())
+                           .arg(format.channelCount())
+                           .arg(renderTap_.hasProcessor() ? "on" : "off"));
+    return true;
+}
+
+void MediaPipeline::stopAudioOutput()
+{
+    if (audioOutputActive_ && playbackThread_.isRunning()) {
+        QMetaObject::invokeMethod(playbackWorker_, [this]() {
+            playbackWorker_->stop();
+        }, Qt::BlockingQueuedConnection);
+    }
+    audioOutputActive_ = false;
+    audioMixer_.reset();
 }
 
 void MediaPipeline::stopStreamReaders(const QString& trackSid)
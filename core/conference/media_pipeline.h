@@ -1,22 +1,29 @@
 #ifndef CORE_CONFERENCE_MEDIA_PIPELINE_H
 #define CORE_CONFERENCE_MEDIA_PIPELINE_H
 
-#include <QAudioFormat>
-#include <QAudioSink>
-#include <QImage>
 #include <QMap>
-#include <QIODevice>
-#include <QSharedPointer>
+#include <QSet>
 #include <QString>
+#include <QStringList>
 #include <QObject>
-#include <QMediaDevices>
-#include <QAudioDevice>
+#include <QThread>
+#include <QTimer>
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <thread>
 #include "livekit/livekit.h"
+#include "../audio/audio_mixer.h"
+#include "../audio/audio_playback_worker.h"
+#include "../audio/render_reference_tap.h"
+#include "../audio/voice_activity_detector.h"
+#include "../media/track_executor.h"
+#include "../video/i420_frame.h"
+#include "../video/latest_frame_mailbox.h"
+#include "../video/video_view_registry.h"
 
+class AudioProcessingModule;
 class ParticipantStore;
 
 class MediaPipeline : public QObject {
@@ -42,27 +49,94 @@ public:
     void removeVideoStream(const QString& trackSid);
     void removeAudioStream(const QString& trackSid);
 
+    // Per-track playback controls, applied inside the mixer
+    void setAudioTrackVolume(const QString& trackSid, float volume);
+    void setAudioTrackMuted(const QString& trackSid, bool muted);
+
+    // Jitter buffer latency and concealment statistics for a remote audio track
+    links::audio::JitterBufferStats audioTrackStatistics(const QString& trackSid) const;
+
+    // Received / delivered / dropped frame counts for a remote video track
+    links::video::FrameMailboxStats videoTrackStatistics(const QString& trackSid) const;
+
+    // Frames of a remote video track skipped because no view showed them,
+    // and frames downscaled for the views that did
+    struct VideoViewStats {
+        int64_t hidden = 0;
+        int64_t downscaled = 0;
+    };
+    VideoViewStats videoViewStatistics(const QString& trackSid) const;
+
+    // Feeds the mixed playback to |apm| as the echo canceller's far-end
+    // reference; nullptr detaches. |apm| must stay alive until detached.
+    void setEchoCanceller(AudioProcessingModule* apm);
+
+    // Adds the local microphone's detector to speaking updates and the
+    // active-speaker ranking under |identity|
+    void setLocalVoiceActivity(const QString& identity,
+                               std::shared_ptr<const links::audio::VoiceActivityDetector> detector);
+
+    // Re-evaluates |identity| after one of its detectors changed state and
+    // emits speakingChanged() if the participant-level state flipped
+    void updateSpeakingState(const QString& identity);
+
+    // Speaking participants, loudest first
+    QStringList activeSpeakers() const { return activeSpeakers_; }
+
 signals:
     void videoFrameReady(const QString& participantIdentity,
                          const QString& trackSid,
-                         const QImage& frame,
+                         const links::video::I420FrameRef& frame,
                          livekit::TrackSource source);
     void audioActivity(const QString& participantIdentity, bool hasAudio);
+    void speakingChanged(const QString& participantIdentity, bool speaking);
+    void activeSpeakersChanged(const QStringList& identities);
+
+    // Simulcast hook: the views of a remote video track changed what they
+    // need (hidden, or at most |width| x |height| device pixels). Emitted
+    // from the track executor; the receiver can ask the SFU for a matching
+    // layer so less is decoded in the first place.
+    void videoLayerRequested(const QString& trackSid, bool visible, int width, int height);
 
 private:
-    struct AudioPlayback {
-        QSharedPointer<QAudioSink> sink;
-        QIODevice* device{nullptr};
-        QAudioFormat format;
+    using VideoMailbox = links::video::LatestFrameMailbox<links::video::I420FrameRef>;
+
+    // What the views of one remote video track need, looked up in the
+    // VideoViewRegistry. Only touched by the track's executor tasks, apart
+    // from the counters.
+    struct VideoTrackView {
+        std::string participant;
+        links::video::VideoViewSource source = links::video::VideoViewSource::Camera;
+        uint64_t generation = ~uint64_t{0};
+        links::video::VideoViewDemand demand;
+        links::video::VideoViewDemand requested;
+        bool layerRequested = false;
+        std::chrono::steady_clock::time_point lastHiddenFrame;
+        bool delivered = false;
+        bool formatWarned = false;
+        std::atomic<int64_t> hidden{0};
+        std::atomic<int64_t> downscaled{0};
     };
 
-    void handleVideoFrame(const livekit::VideoFrameEvent& event,
-                          const QString& trackSid,
-                          const QString& participantIdentity);
-    void handleAudioFrame(const livekit::AudioFrameEvent& event,
+    // Executor side of a remote video frame: drops it when no view shows the
+    // track, otherwise wraps or downscales its I420 buffer. Returns nullptr
+    // for dropped frames.
+    links::video::I420FrameRef prepareVideoFrame(const QString& trackSid,
+                                                 std::shared_ptr<livekit::VideoFrameEvent> frame,
+                                                 VideoTrackView* view);
+    // Takes the newest frame waiting for |trackSid|, if the track is still live
+    void deliverVideoFrame(const QString& trackSid,
+                           const QString& participantIdentity,
+                           const std::shared_ptr<VideoMailbox>& mailbox);
+    void handleVideoFrame(const links::video::I420FrameRef& frame,
                           const QString& trackSid,
                           const QString& participantIdentity);
+    void removeVideoMailbox(const QString& trackSid);
+    bool ensureAudioOutput();
+    void stopAudioOutput();
     void stopStreamReaders(const QString& trackSid);
+    void removeVoiceActivity(const QString& key);
+    void updateActiveSpeakers();
 
     ParticipantStore* participantStore_;
     QMap<QString, std::shared_ptr<livekit::VideoStream>> videoStreams_;
@@ -70,7 +144,38 @@ private:
     std::map<QString, std::unique_ptr<std::thread>> videoStreamThreads_;
     std::map<QString, std::unique_ptr<std::thread>> audioStreamThreads_;
     QMap<QString, std::atomic<bool>*> streamStopFlags_;
-    QMap<QString, AudioPlayback> audioPlayers_;
+
+    // One single-slot mailbox per remote video track. Readers overwrite the
+    // slot and queue a delivery only when it was empty, so a slow GUI thread
+    // drops stale frames instead of accumulating them in its event queue.
+    std::map<QString, std::shared_ptr<VideoMailbox>> videoMailboxes_;
+    std::map<QString, std::shared_ptr<VideoTrackView>> videoTrackViews_;
+
+    // All remote audio is mixed into one pull-mode output stream. Reader
+    // threads feed the mixer directly and the sink pulls on the playback
+    // thread, so no audio work reaches the GUI thread.
+    std::unique_ptr<links::audio::AudioMixer> audioMixer_;
+    QThread playbackThread_;
+    links::audio::AudioPlaybackWorker* playbackWorker_;
+    bool audioOutputActive_{false};
+    links::audio::RenderReferenceTap renderTap_;
+
+    // Speaking detectors keyed by track sid (plus one entry for the local
+    // microphone). Detectors run on the reader/capture threads; only state
+    // transitions are queued here, and the ranking polls levels at 5 Hz.
+    struct VoiceActivityEntry {
+        QString identity;
+        std::shared_ptr<const links::audio::VoiceActivityDetector> detector;
+    };
+    std::map<QString, VoiceActivityEntry> voiceActivity_;
+    QSet<QString> speakingIdentities_;
+    QStringList activeSpeakers_;
+    QTimer speakerRankingTimer_;
+
+    // Shared pool, sized to the cores, that runs the per-frame work of every
+    // remote track with per-track ordering and round-robin fairness. Declared
+    // last so its workers are joined before anything its tasks touch goes away.
+    std::unique_ptr<links::media::TrackExecutor> trackExecutor_;
 };
 
 #endif // CORE_CONFERENCE_MEDIA_PIPELINE_H
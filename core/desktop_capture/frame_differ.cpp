@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Desktop Capture - Frame Differ Implementation
+ */
+
+#include "frame_differ.h"
+#include <algorithm>
+#include <cstring>
+
+namespace links {
+namespace desktop_capture {
+
+namespace {
+
+constexpr int kBytesPerPixel = 4;
+
+}  // namespace
+
+std::vector<DesktopRect> findUpdatedRects(const uint8_t* previous, int previousStride,
+                                          const uint8_t* current, int currentStride,
+                                          const DesktopSize& size, int blockSize) {
+    std::vector<DesktopRect> rects;
+    if (size.isEmpty() || !previous || !current || blockSize <= 0) {
+        return rects;
+    }
+
+    const int width = size.width();
+    const int height = size.height();
+    const int blockColumns = (width + blockSize - 1) / blockSize;
+    std::vector<bool> dirty(blockColumns);
+    // Rects ending on the previous block row, which may grow downwards
+    std::vector<size_t> open;
+    std::vector<size_t> stillOpen;
+
+    for (int top = 0; top < height; top += blockSize) {
+        const int bottom = std::min(top + blockSize, height);
+        std::fill(dirty.begin(), dirty.end(), false);
+
+        for (int y = top; y < bottom; ++y) {
+            const uint8_t* before = previous + static_cast<size_t>(y) * previousStride;
+            const uint8_t* after = current + static_cast<size_t>(y) * currentStride;
+            // Most rows of a mostly static screen are identical as a whole
+            if (std::memcmp(before, after, static_cast<size_t>(width) * kBytesPerPixel) == 0) {
+                continue;
+            }
+            for (int column = 0; column < blockColumns; ++column) {
+                if (dirty[column]) {
+                    continue;
+                }
+                const int left = column * blockSize;
+                const size_t offset = static_cast<size_t>(left) * kBytesPerPixel;
+                const size_t span = static_cast<size_t>(std::min(blockSize, width - left)) * kBytesPerPixel;
+                if (std::memcmp(before + offset, after + offset, span) != 0) {
+                    dirty[column] = true;
+                }
+            }
+        }
+
+        stillOpen.clear();
+        for (int column = 0; column < blockColumns;) {
+            if (!dirty[column]) {
+                ++column;
+                continue;
+            }
+            const int first = column;
+            while (column < blockColumns && dirty[column]) {
+                ++column;
+            }
+            const int left = first * blockSize;
+            const int right = std::min(column * blockSize, width);
+
+            size_t index = rects.size();
+            for (size_t candidate : open) {
+                if (rects[candidate].left() == left && rects[candidate].right() == right) {
+                    index = candidate;
+                    break;
+                }
+            }
+            if (index < rects.size()) {
+                rects[index] = DesktopRect::makeLTRB(left, rects[index].top(), right, bottom);
+            } else {
+                rects.push_back(DesktopRect::makeLTRB(left, top, right, bottom));
+            }
+            stillOpen.push_back(index);
+        }
+        open.swap(stillOpen);
+    }
+    return rects;
+}
+
+}  // namespace desktop_capture
+}  // namespace links
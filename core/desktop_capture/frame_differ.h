@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Desktop Capture - Frame Differ
+ */
+
+#ifndef DESKTOP_CAPTURE_FRAME_DIFFER_H_
+#define DESKTOP_CAPTURE_FRAME_DIFFER_H_
+
+#include <cstdint>
+#include <vector>
+#include "desktop_geometry.h"
+
+namespace links {
+namespace desktop_capture {
+
+// Block edge used by findUpdatedRects: small enough that a caret or a
+// clock stays a small upload, large enough to keep the rect count low
+constexpr int kDifferBlockSize = 32;
+
+// Parts of a 4-byte-per-pixel frame that differ from the previous frame of
+// the same size. The frame is compared in |blockSize| x |blockSize| blocks;
+// changed blocks in a block row are merged into runs, and runs spanning the
+// same columns in consecutive block rows are merged into one rect. Rects
+// are clipped to |size|; an unchanged frame yields no rects.
+std::vector<DesktopRect> findUpdatedRects(const uint8_t* previous, int previousStride,
+                                          const uint8_t* current, int currentStride,
+                                          const DesktopSize& size,
+                                          int blockSize = kDifferBlockSize);
+
+}  // namespace desktop_capture
+}  // namespace links
+
+#endif  // DESKTOP_CAPTURE_FRAME_DIFFER_H_
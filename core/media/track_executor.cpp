@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Media - Track Executor
+ */
+
+#include "track_executor.h"
+
+#include <algorithm>
+
+namespace links {
+namespace media {
+
+TrackExecutor::TrackExecutor(size_t threadCount, size_t maxQueuedPerTrack)
+    : maxQueuedPerTrack_(std::max<size_t>(1, maxQueuedPerTrack)) {
+    if (threadCount == 0) {
+        threadCount = std::max(2u, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back(&TrackExecutor::workerLoop, this);
+    }
+}
+
+TrackExecutor::~TrackExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        for (auto& entry : tracks_) {
+            entry.second->removed = true;
+            entry.second->queue.clear();
+        }
+        tracks_.clear();
+        ready_.clear();
+    }
+    workAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void TrackExecutor::addTrack(const std::string& key, size_t maxQueued) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& track = tracks_[key];
+    if (!track) {
+        track = std::make_shared<Track>();
+    }
+    track->maxQueued = maxQueued > 0 ? maxQueued : maxQueuedPerTrack_;
+}
+
+void TrackExecutor::removeTrack(const std::string& key) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const auto it = tracks_.find(key);
+    if (it == tracks_.end()) {
+        return;
+    }
+    const std::shared_ptr<Track> track = it->second;
+    tracks_.erase(it);
+    track->removed = true;
+    track->queue.clear();
+    ready_.erase(std::remove(ready_.begin(), ready_.end(), track), ready_.end());
+    track->scheduled = false;
+
+    // The caller may tear down what the task uses once this returns
+    taskFinished_.wait(lock, [&track]() { return !track->running; });
+}
+
+bool TrackExecutor::post(const std::string& key, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = tracks_.find(key);
+        if (it == tracks_.end() || stopping_) {
+            return false;
+        }
+        Track& track = *it->second;
+        if (track.queue.size() >= track.maxQueued) {
+            track.queue.pop_front();
+            ++track.stats.dropped;
+        }
+        track.queue.push_back(std::move(task));
+        if (track.running || track.scheduled) {
+            return true;
+        }
+        track.scheduled = true;
+        ready_.push_back(it->second);
+    }
+    workAvailable_.notify_one();
+    return true;
+}
+
+size_t TrackExecutor::trackCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tracks_.size();
+}
+
+TrackExecutorStats TrackExecutor::trackStats(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = tracks_.find(key);
+    return it != tracks_.end() ? it->second->stats : TrackExecutorStats();
+}
+
+void TrackExecutor::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        workAvailable_.wait(lock, [this]() { return stopping_ || !ready_.empty(); });
+        if (stopping_) {
+            return;
+        }
+
+        std::shared_ptr<Track> track = std::move(ready_.front());
+        ready_.pop_front();
+        track->scheduled = false;
+        if (track->queue.empty()) {
+            continue;
+        }
+        Task task = std::move(track->queue.front());
+        track->queue.pop_front();
+        track->running = true;
+
+        lock.unlock();
+        task();
+        task = nullptr;
+        lock.lock();
+
+        track->running = false;
+        if (!track->removed) {
+            ++track->stats.executed;
+            // One task per turn: a busy track goes to the back of the line
+            if (!track->queue.empty()) {
+                track->scheduled = true;
+                ready_.push_back(track);
+                workAvailable_.notify_one();
+            }
+        }
+        taskFinished_.notify_all();
+    }
+}
+
+}  // namespace media
+}  // namespace links
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Media - Track Executor
+ */
+
+#ifndef MEDIA_TRACK_EXECUTOR_H_
+#define MEDIA_TRACK_EXECUTOR_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace links {
+namespace media {
+
+struct TrackExecutorStats {
+    int64_t executed = 0;  // tasks run to completion
+    int64_t dropped = 0;   // discarded because the track's queue was full
+};
+
+// Fixed-size worker pool shared by all remote tracks.
+//
+// Every track has its own FIFO queue. Tasks of one track run in order and
+// never concurrently, so per-track state (mixer queue, detector, mailbox)
+// needs no extra locking. Workers serve tracks round-robin, one task at a
+// time, so a track with a deep backlog (a 4K screen share) cannot starve a
+// camera or microphone. When a track's queue is full the oldest task is
+// dropped: stale media is worth less than fresh media. Tracks that cannot
+// afford drops (audio, where a lost frame is an audible gap) are registered
+// with a deeper queue.
+class TrackExecutor {
+public:
+    using Task = std::function<void()>;
+
+    // |threadCount| == 0 sizes the pool to the hardware concurrency
+    explicit TrackExecutor(size_t threadCount = 0, size_t maxQueuedPerTrack = 8);
+    ~TrackExecutor();
+
+    TrackExecutor(const TrackExecutor&) = delete;
+    TrackExecutor& operator=(const TrackExecutor&) = delete;
+
+    // |maxQueued| == 0 uses the executor's maxQueuedPerTrack
+    void addTrack(const std::string& key, size_t maxQueued = 0);
+    // Discards queued tasks and waits for a running one to finish. Must not
+    // be called from one of the track's own tasks.
+    void removeTrack(const std::string& key);
+
+    // Any thread. Returns false if |key| is not registered.
+    bool post(const std::string& key, Task task);
+
+    size_t threadCount() const { return workers_.size(); }
+    size_t trackCount() const;
+    TrackExecutorStats trackStats(const std::string& key) const;
+
+private:
+    struct Track {
+        std::deque<Task> queue;
+        size_t maxQueued = 0;
+        bool running = false;   // a worker is executing one of its tasks
+        bool scheduled = false; // present in ready_
+        bool removed = false;
+        TrackExecutorStats stats;
+    };
+
+    void workerLoop();
+
+    const size_t maxQueuedPerTrack_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable taskFinished_;
+    std::map<std::string, std::shared_ptr<Track>> tracks_;
+    // Tracks with queued work and no running task, in service order
+    std::deque<std::shared_ptr<Track>> ready_;
+    bool stopping_ = false;
+
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace media
+}  // namespace links
+
+#endif  // MEDIA_TRACK_EXECUTOR_H_
@@ -1,14 +1,13 @@
 #include "microphone_capturer.h"
 #include "../utils/logger.h"
-#include "livekit/audio_frame.h"
+#include "audio/audio_capture_worker.h"
 #include <QMediaDevices>
-#include <vector>
 
 MicrophoneCapturer::MicrophoneCapturer(QObject* parent)
     : QObject(parent),
-      audioInput_(nullptr),
       isActive_(false),
-      samplesProcessed_(0)
+      realtimePriority_(true),
+      captureWorker_(new links::audio::AudioCaptureWorker())
 {
     // Set up audio format (48kHz, 16-bit, mono)
     format_.setSampleRate(48000);
@@ -20,57 +19,24 @@ MicrophoneCapturer::MicrophoneCapturer(QObject* parent)
         Logger::instance().warning("Failed to initialize Audio Processing Module");
     }
     
-    // Get default or selected audio input device
-    QAudioDevice deviceInfo;
-    if (!selectedDevice_.isNull()) {
-        // Check if selected device is still available
-        const auto devices = QMediaDevices::audioInputs();
-        bool found = false;
-        for (const auto& dev : devices) {
-            if (dev.id() == selectedDevice_.id()) {
-                deviceInfo = dev;
-                found = true;
-                break;
-            }
-        }
-        if (!found) {
-            Logger::instance().warning(QString("Selected microphone '%1' not found, using default")
-                                      .arg(selectedDevice_.description()));
-            deviceInfo = QMediaDevices::defaultAudioInput();
-        }
-    } else {
-        deviceInfo = QMediaDevices::defaultAudioInput();
-    }
-    if (deviceInfo.isNull()) {
-        Logger::instance().warning("No microphone available");
-        emit error("No microphone available");
-        return;
-    }
-    
-    Logger::instance().info(QString("Using microphone: %1").arg(deviceInfo.description()));
-    
-    // Check if format is supported
-    if (!deviceInfo.isFormatSupported(format_)) {
-        Logger::instance().warning("Audio format not supported, using nearest");
-        format_ = deviceInfo.preferredFormat();
-        
-        // Try to adjust to our preferred settings
-        format_.setSampleRate(48000);
-        format_.setChannelCount(1);
-        format_.setSampleFormat(QAudioFormat::Int16);
-    }
-    
-    // Create audio source
-    audioSource_ = std::make_unique<QAudioSource>(deviceInfo, format_);
-    
-    // Connect state changed signal
-    connect(audioSource_.get(), &QAudioSource::stateChanged,
-            this, &MicrophoneCapturer::onStateChanged);
+    captureThread_.setObjectName("AudioCapture");
+    captureWorker_->moveToThread(&captureThread_);
+    connect(captureWorker_, &links::audio::AudioCaptureWorker::error,
+            this, &MicrophoneCapturer::error);
+    connect(captureWorker_, &links::audio::AudioCaptureWorker::speakingChanged,
+            this, &MicrophoneCapturer::speakingChanged);
+    connect(captureWorker_, &links::audio::AudioCaptureWorker::deviceSwitched,
+            this, &MicrophoneCapturer::onDeviceSwitched);
 }
 
 MicrophoneCapturer::~MicrophoneCapturer()
 {
     stop();
+    if (captureThread_.isRunning()) {
+        captureThread_.quit();
+        captureThread_.wait();
+    }
+    delete captureWorker_;
 }
 
 bool MicrophoneCapturer::start()
@@ -79,8 +45,10 @@ bool MicrophoneCapturer::start()
         return true;
     }
     
-    if (!audioSource_) {
-        Logger::instance().error("Audio source not initialized");
+    const QAudioDevice deviceInfo = resolveDevice();
+    if (deviceInfo.isNull()) {
+        Logger::instance().warning("No microphone available");
+        emit error("No microphone available");
         return false;
     }
     
@@ -94,31 +62,39 @@ bool MicrophoneCapturer::start()
         return false;
     }
     
+    if (!captureThread_.isRunning()) {
+        captureThread_.start(capturePriority());
+    }
+    
+    bool started = false;
     try {
-        audioInput_ = audioSource_->start();
-        if (!audioInput_) {
-            Logger::instance().error("Failed to start audio input");
-            livekitAudioSource_.reset();
-            return false;
-        }
-        
-        // Connect ready read signal
-        connect(audioInput_, &QIODevice::readyRead,
-                this, &MicrophoneCapturer::onReadyRead);
-        
-        isActive_ = true;
-        samplesProcessed_ = 0;
-        
-        Logger::instance().info(QString("Microphone started (rate: %1, channels: %2)")
-                               .arg(format_.sampleRate())
-                               .arg(format_.channelCount()));
-        return true;
+        // The worker opens the device on the capture thread; wait for the result
+        const QAudioFormat format = format_;
+        const auto source = livekitAudioSource_;
+        AudioProcessingModule* apm = &apm_;
+        QMetaObject::invokeMethod(captureWorker_, [&started, this, deviceInfo, format, source, apm]() {
+            started = captureWorker_->start(deviceInfo, format, source, apm);
+        }, Qt::BlockingQueuedConnection);
     } catch (const std::exception& e) {
         Logger::instance().error(QString("Failed to start microphone: %1").arg(e.what()));
         emit error(QString("Failed to start microphone: %1").arg(e.what()));
+        started = false;
+    }
+    
+    if (!started) {
         livekitAudioSource_.reset();
         return false;
     }
+    
+    isActive_ = true;
+    activeDevice_ = selectedDevice_;
+    activeFormat_ = format_;
+    liveSwitches_.clear();
+    Logger::instance().info(QString("Microphone started on capture thread (device rate: %1, channels: %2, realtime priority: %3)")
+                           .arg(format_.sampleRate())
+                           .arg(format_.channelCount())
+                           .arg(realtimePriority_ ? "on" : "off"));
+    return true;
 }
 
 void MicrophoneCapturer::stop()
@@ -127,136 +103,183 @@ void MicrophoneCapturer::stop()
         return;
     }
     
-    if (audioSource_) {
-        audioSource_->stop();
+    if (captureThread_.isRunning()) {
+        QMetaObject::invokeMethod(captureWorker_, [this]() {
+            captureWorker_->stop();
+        }, Qt::BlockingQueuedConnection);
     }
     
-    audioInput_ = nullptr;
     isActive_ = false;
+    // A switch abandoned by stop() reports nothing
+    liveSwitches_.clear();
     
     // Reset LiveKit audio source
     livekitAudioSource_.reset();
     
-    // Clear audio buffer
-    audioBuffer_.clear();
-    
-    Logger::instance().info(QString("Microphone stopped (processed %1 samples)")
-                           .arg(samplesProcessed_));
+    Logger::instance().info("Microphone stopped");
 }
 
+void MicrophoneCapturer::setMuted(bool muted)
+{
+    if (!isActive_) {
+        return;
+    }
+    captureWorker_->setMuted(muted);
+    Logger::instance().info(QString("Microphone %1 (device kept open)").arg(muted ? "muted" : "unmuted"));
+}
+
+bool MicrophoneCapturer::isMuted() const
+{
+    return isActive_ && captureWorker_->isMuted();
+}
+
 QList<QAudioDevice> MicrophoneCapturer::availableDevices()
 {
     return QMediaDevices::audioInputs();
 }
 
-void MicrophoneCapturer::onReadyRead()
+QAudioDevice MicrophoneCapturer::resolveDevice()
 {
-    if (!audioInput_ || !isActive_) {
-        return;
+    // Get default or selected audio input device
+    QAudioDevice deviceInfo;
+    if (!selectedDevice_.isNull()) {
+        // Check if selected device is still available
+        const auto devices = QMediaDevices::audioInputs();
+        bool found = false;
+        for (const auto& dev : devices) {
+            if (dev.id() == selectedDevice_.id()) {
+                deviceInfo = dev;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            Logger::instance().warning(QString("Selected microphone '%1' not found, using default")
+                                      .arg(selectedDevice_.description()));
+            deviceInfo = QMediaDevices::defaultAudioInput();
+        }
+    } else {
+        deviceInfo = QMediaDevices::defaultAudioInput();
     }
-    
-    const QByteArray data = audioInput_->readAll();
-    if (!data.isEmpty()) {
-        processAudioData(data);
+    if (deviceInfo.isNull()) {
+        return deviceInfo;
     }
+    
+    Logger::instance().info(QString("Using microphone: %1").arg(deviceInfo.description()));
+    format_ = captureFormatFor(deviceInfo);
+    return deviceInfo;
 }
 
-void MicrophoneCapturer::onStateChanged(QAudio::State state)
+QAudioFormat MicrophoneCapturer::captureFormatFor(const QAudioDevice& device) const
 {
-    switch (state) {
-        case QAudio::ActiveState:
-            Logger::instance().debug("Audio state: Active");
-            break;
-        case QAudio::SuspendedState:
-            Logger::instance().debug("Audio state: Suspended");
-            break;
-        case QAudio::StoppedState:
-            Logger::instance().debug("Audio state: Stopped");
-            break;
-        case QAudio::IdleState:
-            Logger::instance().debug("Audio state: Idle");
-            break;
+    // Prefer 48kHz mono Int16 (no conversion); otherwise open the device in
+    // its native format and let the capture worker resample and downmix
+    QAudioFormat format;
+    format.setSampleRate(48000);
+    format.setChannelCount(1);
+    format.setSampleFormat(QAudioFormat::Int16);
+    if (!device.isFormatSupported(format)) {
+        format = device.preferredFormat();
+        Logger::instance().info(QString("Microphone does not support 48kHz mono Int16, using native format "
+                                        "(rate: %1, channels: %2, sample format: %3)")
+                                .arg(format.sampleRate())
+                                .arg(format.channelCount())
+                                .arg(static_cast<int>(format.sampleFormat())));
     }
+    return format;
 }
 
-void MicrophoneCapturer::processAudioData(const QByteArray& data)
+bool MicrophoneCapturer::switchDevice(const QByteArray& deviceId)
 {
-    if (!livekitAudioSource_) {
-        return;
+    if (!isActive_) {
+        setDeviceById(deviceId);
+        return true;
     }
     
-    // Calculate samples from incoming data
-    const int bytesPerSample = format_.bytesPerSample();
-    const int numChannels = format_.channelCount();
-    const int incomingSamples = data.size() / bytesPerSample / numChannels;
-    
-    if (incomingSamples <= 0) {
-        return;
+    QAudioDevice device = deviceId.isEmpty() ? QMediaDevices::defaultAudioInput() : QAudioDevice();
+    if (device.isNull()) {
+        for (const auto& candidate : QMediaDevices::audioInputs()) {
+            if (candidate.id() == deviceId) {
+                device = candidate;
+                break;
+            }
+        }
+    }
+    if (device.isNull()) {
+        Logger::instance().warning(QString("Microphone with ID '%1' not found")
+                                  .arg(QString(deviceId)));
+        return false;
     }
     
-    // Get pointer to incoming audio data
-    const int16_t* incomingData = reinterpret_cast<const int16_t*>(data.constData());
-    
-    // Add incoming samples to buffer
-    audioBuffer_.insert(audioBuffer_.end(), incomingData, incomingData + incomingSamples * numChannels);
+    const QAudioFormat format = captureFormatFor(device);
+    const int generation = ++switchGeneration_;
+    bool opened = false;
+    QMetaObject::invokeMethod(captureWorker_, [&opened, this, device, format, generation]() {
+        opened = captureWorker_->switchDevice(device, format, generation);
+    }, Qt::BlockingQueuedConnection);
+    if (!opened) {
+        return false;
+    }
     
-    // Send buffered frames (each 10ms = 480 samples at 48kHz)
-    sendBufferedFrames();
+    // The swap itself completes on the capture thread
+    selectedDevice_ = deviceId.isEmpty() ? QAudioDevice() : device;
+    format_ = format;
+    liveSwitches_.append({generation, selectedDevice_, format});
+    Logger::instance().info(QString("Switching microphone live to: %1").arg(device.description()));
+    return true;
 }
 
-void MicrophoneCapturer::sendBufferedFrames()
+void MicrophoneCapturer::onDeviceSwitched(int generation, bool success)
 {
-    if (!livekitAudioSource_) {
+    // Switches older than this one were superseded before they completed
+    while (!liveSwitches_.isEmpty() && liveSwitches_.first().generation < generation) {
+        liveSwitches_.removeFirst();
+    }
+    if (liveSwitches_.isEmpty() || liveSwitches_.first().generation != generation) {
         return;
     }
-    
-    const int numChannels = format_.channelCount();
-    const int frameSizeTotalSamples = kFrameSizeSamples * numChannels;
-    
-    // Process all complete 10ms frames in the buffer
-    while (audioBuffer_.size() >= static_cast<size_t>(frameSizeTotalSamples)) {
-        try {
-            // Extract one frame worth of samples
-            std::vector<int16_t> frameData(audioBuffer_.begin(), 
-                                           audioBuffer_.begin() + frameSizeTotalSamples);
-            
-            // Process through Audio Processing Module (in-place)
-            if (apm_.isInitialized()) {
-                apm_.processFrame(frameData.data(), kFrameSizeSamples, 
-                                 format_.sampleRate(), numChannels);
-            }
-            
-            // Create audio frame and send to LiveKit
-            livekit::AudioFrame frame(std::move(frameData),
-                                      format_.sampleRate(), 
-                                      numChannels, 
-                                      kFrameSizeSamples);
-            
-            // Send to LiveKit
-            livekitAudioSource_->captureFrame(frame);
-            
-            // Remove sent samples from buffer
-            audioBuffer_.erase(audioBuffer_.begin(), 
-                              audioBuffer_.begin() + frameSizeTotalSamples);
-            
-            samplesProcessed_ += kFrameSizeSamples;
-            
-        } catch (const std::exception& e) {
-            Logger::instance().error(QString("Failed to capture audio: %1").arg(e.what()));
-            break;
-        }
+    const LiveSwitch result = liveSwitches_.takeFirst();
+    if (success) {
+        activeDevice_ = result.device;
+        activeFormat_ = result.format;
     }
-    
-    // Log every second (48000 samples at 48kHz)
-    static int64_t lastLoggedSamples = 0;
-    if (samplesProcessed_ - lastLoggedSamples >= 48000) {
-        Logger::instance().debug(QString("Captured %1 audio samples (buffer: %2)")
-                                .arg(samplesProcessed_)
-                                .arg(audioBuffer_.size()));
-        lastLoggedSamples = samplesProcessed_;
+    // A newer switch is still running; its outcome is the one reported
+    if (!liveSwitches_.isEmpty()) {
+        return;
+    }
+    if (!success) {
+        selectedDevice_ = activeDevice_;
+        format_ = activeFormat_;
+    }
+    emit deviceSwitched(success);
+}
+
+QThread::Priority MicrophoneCapturer::capturePriority() const
+{
+    // NormalPriority rather than InheritPriority: a running thread cannot be
+    // set back to InheritPriority, and the setting must mean the same thing
+    // whether it is applied before or after start()
+    return realtimePriority_ ? QThread::TimeCriticalPriority : QThread::NormalPriority;
+}
+
+void MicrophoneCapturer::setRealtimePriorityEnabled(bool enabled)
+{
+    realtimePriority_ = enabled;
+    if (captureThread_.isRunning()) {
+        captureThread_.setPriority(capturePriority());
     }
 }
 
+links::audio::CaptureStatsSnapshot MicrophoneCapturer::captureStatistics() const
+{
+    return captureWorker_->statistics();
+}
+
+std::shared_ptr<const links::audio::VoiceActivityDetector> MicrophoneCapturer::voiceActivity() const
+{
+    return captureWorker_->voiceActivity();
+}
+
 void MicrophoneCapturer::setDevice(const QAudioDevice& device)
 {
     if (isActive_) {
@@ -264,20 +287,7 @@ void MicrophoneCapturer::setDevice(const QAudioDevice& device)
         return;
     }
     selectedDevice_ = device;
-    audioSource_.reset();
-    
-    // Recreate audio source with new device
     if (!device.isNull()) {
-        if (!device.isFormatSupported(format_)) {
-            Logger::instance().warning("Audio format not supported, using nearest");
-            format_ = device.preferredFormat();
-            format_.setSampleRate(48000);
-            format_.setChannelCount(1);
-            format_.setSampleFormat(QAudioFormat::Int16);
-        }
-        audioSource_ = std::make_unique<QAudioSource>(device, format_);
-        connect(audioSource_.get(), &QAudioSource::stateChanged,
-                this, &MicrophoneCapturer::onStateChanged);
         Logger::instance().info(QString("Microphone device set to: %1").arg(device.description()));
     }
 }
@@ -2,14 +2,30 @@
 #define MICROPHONE_CAPTURER_H
 
 #include <QObject>
-#include <QAudioSource>
+#include <QAudioDevice>
 #include <QAudioFormat>
-#include <QIODevice>
+#include <QList>
+#include <QThread>
 #include <memory>
-#include <vector>
 #include "livekit/audio_source.h"
 #include "audio_processing_module.h"
+#include "audio/capture_stats.h"
+#include "audio/voice_activity_detector.h"
 
+namespace links {
+namespace audio {
+class AudioCaptureWorker;
+}
+}
+
+/**
+ * MicrophoneCapturer - Captures the local microphone into a LiveKit AudioSource
+ * 
+ * Device I/O, buffering, APM and captureFrame run on a dedicated capture
+ * thread (links::audio::AudioCaptureWorker), so a busy GUI event loop can
+ * no longer stall capture. This object stays on the caller's thread and
+ * only configures and starts/stops the worker.
+ */
 class MicrophoneCapturer : public QObject
 {
     Q_OBJECT
@@ -23,6 +39,12 @@ public:
     void stop();
     bool isActive() const { return isActive_; }
     
+    // Warm mute: the device, APM and AudioSource stay alive but no frames are
+    // sent, so unmuting needs no new source or track. Only valid while active;
+    // start() clears it.
+    void setMuted(bool muted);
+    bool isMuted() const;
+    
     // Get the LiveKit audio source
     std::shared_ptr<livekit::AudioSource> getAudioSource() const { return livekitAudioSource_; }
     
@@ -33,43 +55,71 @@ public:
     void setDevice(const QAudioDevice& device);
     void setDeviceById(const QByteArray& deviceId);
     
+    // Live switch while capturing: the new device is opened next to the
+    // current one and crossfaded in once it delivers audio, keeping the
+    // AudioSource (and any track published from it). deviceSwitched()
+    // reports the outcome; a switch superseded by a newer one reports
+    // nothing, and a failure leaves the device that is actually running
+    // selected. When not capturing this only selects the device.
+    bool switchDevice(const QByteArray& deviceId);
+    
     // Audio processing options (AEC, NS, AGC) - delegates to AudioProcessingModule
     void setEchoCancellationEnabled(bool enabled);
     void setNoiseSuppressionEnabled(bool enabled);
     void setAutoGainControlEnabled(bool enabled);
     
+    // Run the capture thread at time-critical priority (applies immediately)
+    void setRealtimePriorityEnabled(bool enabled);
+    bool isRealtimePriorityEnabled() const { return realtimePriority_; }
+    
+    // Jitter, overrun and processing-time statistics of the current session
+    links::audio::CaptureStatsSnapshot captureStatistics() const;
+    
+    // Speaking state of the processed microphone signal (readable from any thread)
+    std::shared_ptr<const links::audio::VoiceActivityDetector> voiceActivity() const;
+    
     // Get the audio processing module for advanced configuration
     AudioProcessingModule* audioProcessingModule() { return &apm_; }
     
 signals:
     void error(const QString& message);
-    
-private slots:
-    void onReadyRead();
-    void onStateChanged(QAudio::State state);
+    void speakingChanged(bool speaking);
+    void deviceSwitched(bool success);
     
 private:
-    void processAudioData(const QByteArray& data);
-    void sendBufferedFrames();
+    QAudioDevice resolveDevice();
+    QAudioFormat captureFormatFor(const QAudioDevice& device) const;
+    QThread::Priority capturePriority() const;
+    void onDeviceSwitched(int generation, bool success);
     
-    std::unique_ptr<QAudioSource> audioSource_;
     std::shared_ptr<livekit::AudioSource> livekitAudioSource_;
-    QIODevice* audioInput_;
     QAudioFormat format_;
     
     bool isActive_;
-    int64_t samplesProcessed_;
+    bool realtimePriority_;
     
     // Selected audio device
     QAudioDevice selectedDevice_;
+    // Selection and format the capture thread is actually running; restored
+    // if the latest live switch fails
+    QAudioDevice activeDevice_;
+    QAudioFormat activeFormat_;
+    // Live switches whose result has not arrived yet, oldest first. Results
+    // come back in request order, tagged with the generation.
+    struct LiveSwitch {
+        int generation;
+        QAudioDevice device;
+        QAudioFormat format;
+    };
+    QList<LiveSwitch> liveSwitches_;
+    int switchGeneration_{0};
     
-    // Audio Processing Module
+    // Audio Processing Module (runs on the capture thread)
     AudioProcessingModule apm_;
     
-    // Audio buffer for accumulating samples to send in 10ms frames
-    // At 48kHz mono, 10ms = 480 samples
-    static constexpr int kFrameSizeSamples = 480; // 10ms at 48kHz
-    std::vector<int16_t> audioBuffer_;
+    // Capture thread and the worker that lives on it
+    QThread captureThread_;
+    links::audio::AudioCaptureWorker* captureWorker_;
 };
 
 #endif // MICROPHONE_CAPTURER_H
@@ -5,6 +5,7 @@
 
 #include "screen_capturer.h"
 #include "../utils/logger.h"
+#include "desktop_capture/frame_differ.h"
 #include "livekit/video_frame.h"
 #include "platform_window_ops.h"
 #include <QGuiApplication>
@@ -136,7 +137,7 @@ void ScreenCapturer::captureOnce()
     // Handle minimized windows
     if (mode_ == Mode::Window && isWindowMinimized()) {
         if (!lastValidFrame_.isNull()) {
-            emit frameCaptured(lastValidFrame_);
+            emit frameCaptured(lastValidFrame_, QRegion());
             try {
                 std::vector<uint8_t> frameData(lastValidFrame_.constBits(),
                     lastValidFrame_.constBits() + lastValidFrame_.sizeInBytes());
@@ -180,8 +181,9 @@ void ScreenCapturer::onCaptureResult(DesktopCapturer::Result result,
             return;
         }
 
+        const QRegion updated = updatedRegion(*frame);
         lastValidFrame_ = image;
-        emit frameCaptured(image);
+        emit frameCaptured(image, updated);
 
         try {
             std::vector<uint8_t> frameData(image.constBits(),
@@ -228,6 +230,29 @@ QImage ScreenCapturer::frameToQImage(const DesktopFrame& frame)
     return image.copy();
 }
 
+QRegion ScreenCapturer::updatedRegion(const DesktopFrame& frame) const
+{
+    const QRect whole(0, 0, frame.width(), frame.height());
+    if (lastValidFrame_.size() != whole.size() || lastValidFrame_.format() != QImage::Format_RGBA8888) {
+        return whole;
+    }
+
+    // Capturers that track damage report it; the others report the whole
+    // frame, which is then diffed against the previous one
+    const DesktopRect& reported = frame.updatedRegion();
+    if (reported != DesktopRect::makeSize(frame.size())) {
+        return QRect(reported.x(), reported.y(), reported.width(), reported.height());
+    }
+
+    QRegion region;
+    const auto rects = findUpdatedRects(lastValidFrame_.constBits(), static_cast<int>(lastValidFrame_.bytesPerLine()),
+                                        frame.data(), frame.stride(), frame.size());
+    for (const DesktopRect& rect : rects) {
+        region += QRect(rect.x(), rect.y(), rect.width(), rect.height());
+    }
+    return region;
+}
+
 bool ScreenCapturer::validateWindowHandle() const
 {
     return windowId_ != 0
@@ -13,6 +13,7 @@
 #include <QScreen>
 #include <QTimer>
 #include <QImage>
+#include <QRegion>
 #include <memory>
 #include <atomic>
 #include <mutex>
@@ -50,7 +51,9 @@ public:
                          std::unique_ptr<links::desktop_capture::DesktopFrame> frame) override;
 
 signals:
-    void frameCaptured(const QImage& image);
+    // |updated| is the part of |image| that differs from the previous
+    // frame; empty when nothing changed
+    void frameCaptured(const QImage& image, const QRegion& updated);
     void error(const QString& message);
 
 private slots:
@@ -61,6 +64,7 @@ private:
     bool validateWindowHandle() const;
     bool isWindowMinimized() const;
     QImage frameToQImage(const links::desktop_capture::DesktopFrame& frame);
+    QRegion updatedRegion(const links::desktop_capture::DesktopFrame& frame) const;
     links::desktop_capture::DesktopCapturer::SourceId screenSourceId() const;
 
     std::shared_ptr<livekit::VideoSource> videoSource_;
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Camera Format Selector
+ */
+
+#include "camera_format_selector.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace links {
+namespace video {
+
+namespace {
+
+// Cameras report 29.97 as "30"; anything this close counts as meeting it
+constexpr float kFpsTolerance = 0.5f;
+
+double resolutionCost(const CameraMode& mode, const CaptureProfile& target) {
+    const double area = static_cast<double>(mode.width) * mode.height;
+    const double targetArea = static_cast<double>(target.width) * target.height;
+    if (area <= 0.0 || targetArea <= 0.0) {
+        return 1e9;
+    }
+    return area >= targetArea ? area / targetArea - 1.0 : 2.0 * (targetArea / area - 1.0);
+}
+
+}  // namespace
+
+CaptureProfile captureProfile(CameraQuality quality) {
+    switch (quality) {
+        case CameraQuality::Low:
+            return {320, 240, 15};
+        case CameraQuality::High:
+            return {1280, 720, 30};
+        case CameraQuality::Standard:
+        default:
+            return {640, 480, 30};
+    }
+}
+
+const char* qualityName(CameraQuality quality) {
+    switch (quality) {
+        case CameraQuality::Low:
+            return "low";
+        case CameraQuality::High:
+            return "high";
+        case CameraQuality::Standard:
+        default:
+            return "standard";
+    }
+}
+
+bool parseQuality(const std::string& name, CameraQuality* quality) {
+    for (CameraQuality candidate : {CameraQuality::Low, CameraQuality::Standard, CameraQuality::High}) {
+        if (name == qualityName(candidate)) {
+            *quality = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+int selectCameraMode(const std::vector<CameraMode>& modes, const CaptureProfile& target) {
+    int best = -1;
+    std::tuple<float, double, int, float> bestKey;
+    for (size_t i = 0; i < modes.size(); ++i) {
+        const CameraMode& mode = modes[i];
+        const float shortfall = std::max(0.0f, static_cast<float>(target.fps) - kFpsTolerance - mode.maxFps);
+        const auto key = std::make_tuple(shortfall,
+                                         resolutionCost(mode, target),
+                                         static_cast<int>(mode.encoding),
+                                         mode.maxFps);
+        if (best < 0 || key < bestKey) {
+            best = static_cast<int>(i);
+            bestKey = key;
+        }
+    }
+    return best;
+}
+
+}  // namespace video
+}  // namespace links
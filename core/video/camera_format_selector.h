@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Camera Format Selector
+ */
+
+#ifndef VIDEO_CAMERA_FORMAT_SELECTOR_H_
+#define VIDEO_CAMERA_FORMAT_SELECTOR_H_
+
+#include <string>
+#include <vector>
+
+namespace links {
+namespace video {
+
+// User-selectable capture quality
+enum class CameraQuality {
+    Low,       // 320x240 @ 15 fps
+    Standard,  // 640x480 @ 30 fps
+    High,      // 1280x720 @ 30 fps
+};
+
+struct CaptureProfile {
+    int width = 640;
+    int height = 480;
+    int fps = 30;
+};
+
+CaptureProfile captureProfile(CameraQuality quality);
+
+// "low" / "standard" / "high", as stored in the settings
+const char* qualityName(CameraQuality quality);
+// Unknown names leave |quality| unchanged and return false
+bool parseQuality(const std::string& name, CameraQuality* quality);
+
+// Pixel encoding classes in order of preference: raw YUV goes straight
+// through the I420 kernels, RGB needs a colour conversion, MJPEG needs a
+// decode first
+enum class CameraEncoding {
+    RawYuv,
+    Rgb,
+    Mjpeg,
+    Other,
+};
+
+// One mode a camera offers, independent of the Qt types
+struct CameraMode {
+    int width = 0;
+    int height = 0;
+    float minFps = 0.0f;
+    float maxFps = 0.0f;
+    CameraEncoding encoding = CameraEncoding::Other;
+};
+
+// Index of the mode closest to |target|, or -1 when |modes| is empty.
+//
+// Modes are compared by, in order:
+//  1. frame rate shortfall against the target (none is best),
+//  2. resolution distance, where a smaller mode costs twice as much as an
+//     equally larger one (downscaling beats upscaling),
+//  3. encoding preference (raw YUV over RGB over MJPEG),
+//  4. the smaller maximum frame rate (no more frames than needed).
+// A camera that can only deliver the resolution as MJPEG (typically USB 2.0
+// bandwidth limits on raw modes) therefore gets MJPEG, and raw YUV otherwise.
+int selectCameraMode(const std::vector<CameraMode>& modes, const CaptureProfile& target);
+
+}  // namespace video
+}  // namespace links
+
+#endif  // VIDEO_CAMERA_FORMAT_SELECTOR_H_
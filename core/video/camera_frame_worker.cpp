@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Camera Frame Worker
+ */
+
+#include "camera_frame_worker.h"
+
+#include <QDateTime>
+#include <algorithm>
+#include "livekit/video_frame.h"
+#include "video_kernels.h"
+#include "../../utils/logger.h"
+
+namespace links {
+namespace video {
+
+CameraFrameWorker::CameraFrameWorker(QObject* parent)
+    : QObject(parent) {
+    clock_.start();
+}
+
+CameraFrameWorker::~CameraFrameWorker() = default;
+
+void CameraFrameWorker::setVideoSource(std::shared_ptr<livekit::VideoSource> source) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    videoSource_ = std::move(source);
+}
+
+void CameraFrameWorker::setTargetFps(int fps) {
+    minFrameIntervalMs_.store(1000 / std::max(1, fps), std::memory_order_relaxed);
+}
+
+void CameraFrameWorker::setEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+    if (!enabled) {
+        // Release the pending frame's buffer now rather than on the next one
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ = QVideoFrame();
+        hasPending_ = false;
+    }
+}
+
+void CameraFrameWorker::submit(const QVideoFrame& frame) {
+    if (!enabled_.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.received;
+        if (hasPending_) {
+            ++stats_.superseded;
+        }
+        pending_ = frame;
+        hasPending_ = true;
+        if (!scheduled_) {
+            scheduled_ = true;
+            wake = true;
+        }
+    }
+    // One queued wake-up at a time; later frames just replace pending_
+    if (wake) {
+        QMetaObject::invokeMethod(this, &CameraFrameWorker::processPending, Qt::QueuedConnection);
+    }
+}
+
+void CameraFrameWorker::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_ = QVideoFrame();
+    hasPending_ = false;
+    stats_ = CameraFrameStats();
+    loggedPixelFormat_ = false;
+}
+
+void CameraFrameWorker::resetFormatLog() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    loggedPixelFormat_ = false;
+}
+
+CameraFrameStats CameraFrameWorker::statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void CameraFrameWorker::processPending() {
+    QVideoFrame frame;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        scheduled_ = false;
+        if (!hasPending_) {
+            return;
+        }
+        frame = pending_;
+        pending_ = QVideoFrame();
+        hasPending_ = false;
+    }
+
+    // Frame rate limiting happens here, before any mapping or conversion
+    const qint64 now = clock_.elapsed();
+    if (now - lastFrameTime_ < minFrameIntervalMs_.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.rateLimited;
+        return;
+    }
+    lastFrameTime_ = now;
+
+    processFrame(std::move(frame));
+}
+
+void CameraFrameWorker::processFrame(QVideoFrame frame) {
+    std::shared_ptr<livekit::VideoSource> source;
+    bool logFormat = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        source = videoSource_;
+        logFormat = !loggedPixelFormat_;
+        loggedPixelFormat_ = true;
+    }
+    if (!source) {
+        return;
+    }
+
+    if (!frame.map(QVideoFrame::ReadOnly)) {
+        Logger::instance().warning("Failed to map video frame");
+        return;
+    }
+
+    const int width = frame.width();
+    const int height = frame.height();
+    const qint64 now = clock_.elapsed();
+
+    // YUV frames go straight from the mapped planes to I420 in one pass;
+    // anything else (JPEG, RGB) still takes the QImage route
+    std::vector<uint8_t> frameData;
+    livekit::VideoBufferType bufferType = livekit::VideoBufferType::I420;
+    const bool planar = convertToI420(frame, &frameData);
+
+    // The preview is a QImage, but it does not need every frame
+    QImage preview;
+    if (!planar || now - lastPreviewTime_ >= kPreviewIntervalMs) {
+        preview = frame.toImage();
+        lastPreviewTime_ = now;
+    }
+    frame.unmap();
+
+    if (!planar) {
+        if (preview.isNull()) {
+            Logger::instance().warning("Failed to convert frame to image");
+            return;
+        }
+        if (preview.format() != QImage::Format_RGBA8888) {
+            preview = preview.convertToFormat(QImage::Format_RGBA8888);
+        }
+        frameData.assign(preview.constBits(), preview.constBits() + preview.sizeInBytes());
+        bufferType = livekit::VideoBufferType::RGBA;
+    }
+    if (logFormat) {
+        Logger::instance().info(planar
+            ? QString("Camera pixel format %1 converted natively to I420 (%2)")
+                  .arg(static_cast<int>(frame.pixelFormat()))
+                  .arg(kernels::simdBackend())
+            : QString("Camera pixel format %1 has no planar path, converting via QImage")
+                  .arg(static_cast<int>(frame.pixelFormat())));
+    }
+
+    try {
+        livekit::VideoFrame videoFrame(width, height, bufferType, std::move(frameData));
+
+        // Capture frame with current timestamp in microseconds
+        const int64_t timestampUs = QDateTime::currentMSecsSinceEpoch() * 1000;
+        source->captureFrame(videoFrame, timestampUs);
+    } catch (const std::exception& e) {
+        Logger::instance().error(QString("Failed to capture frame: %1").arg(e.what()));
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.sent;
+    }
+    emit frameSent(width, height);
+    if (!preview.isNull()) {
+        emit previewReady(preview);
+    }
+}
+
+bool CameraFrameWorker::convertToI420(const QVideoFrame& frame, std::vector<uint8_t>* out) {
+    const int width = frame.width();
+    const int height = frame.height();
+    const QVideoFrameFormat::PixelFormat format = frame.pixelFormat();
+    switch (format) {
+        case QVideoFrameFormat::Format_NV12:
+        case QVideoFrameFormat::Format_NV21:
+        case QVideoFrameFormat::Format_YUYV:
+        case QVideoFrameFormat::Format_UYVY:
+        case QVideoFrameFormat::Format_YUV420P:
+        case QVideoFrameFormat::Format_YV12:
+            break;
+        default:
+            return false;
+    }
+
+    out->resize(i420Size(width, height));
+    const I420Planes planes = i420Planes(out->data(), width, height);
+    const int chromaWidth = (width + 1) / 2;
+    const int chromaHeight = (height + 1) / 2;
+
+    switch (format) {
+        case QVideoFrameFormat::Format_NV12:
+        case QVideoFrameFormat::Format_NV21:
+            kernels::nv12ToI420(frame.bits(0), frame.bytesPerLine(0),
+                                frame.bits(1), frame.bytesPerLine(1),
+                                planes, width, height,
+                                format == QVideoFrameFormat::Format_NV21);
+            break;
+        case QVideoFrameFormat::Format_YUYV:
+            kernels::yuy2ToI420(frame.bits(0), frame.bytesPerLine(0), planes, width, height);
+            break;
+        case QVideoFrameFormat::Format_UYVY:
+            kernels::uyvyToI420(frame.bits(0), frame.bytesPerLine(0), planes, width, height);
+            break;
+        default: {
+            // Already planar 4:2:0; YV12 stores V before U
+            const int uPlane = format == QVideoFrameFormat::Format_YV12 ? 2 : 1;
+            const int vPlane = 3 - uPlane;
+            kernels::copyPlane(frame.bits(0), frame.bytesPerLine(0), planes.y, planes.strideY, width, height);
+            kernels::copyPlane(frame.bits(uPlane), frame.bytesPerLine(uPlane),
+                               planes.u, planes.strideU, chromaWidth, chromaHeight);
+            kernels::copyPlane(frame.bits(vPlane), frame.bytesPerLine(vPlane),
+                               planes.v, planes.strideV, chromaWidth, chromaHeight);
+            break;
+        }
+    }
+    return true;
+}
+
+}  // namespace video
+}  // namespace links
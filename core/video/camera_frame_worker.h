@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Camera Frame Worker
+ */
+
+#ifndef VIDEO_CAMERA_FRAME_WORKER_H_
+#define VIDEO_CAMERA_FRAME_WORKER_H_
+
+#include <QElapsedTimer>
+#include <QImage>
+#include <QObject>
+#include <QVideoFrame>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "livekit/video_source.h"
+
+namespace links {
+namespace video {
+
+// Counters of the camera frame path since the last reset()
+struct CameraFrameStats {
+    int64_t received = 0;      // frames handed to submit() while enabled
+    int64_t superseded = 0;    // replaced by a newer frame before processing
+    int64_t rateLimited = 0;   // skipped by the target frame rate
+    int64_t sent = 0;          // submitted to the VideoSource
+};
+
+// Converts camera frames and submits them to the LiveKit VideoSource on its
+// own thread (see CameraCapturer), so a busy GUI event loop never delays
+// outgoing video.
+//
+// submit() may be called from any thread, typically straight from the
+// QVideoSink's emitting thread. Only the newest pending frame is kept: when
+// processing falls behind, older frames are replaced rather than queued, so
+// latency stays at one frame. The local preview is emitted at a reduced rate.
+class CameraFrameWorker : public QObject {
+    Q_OBJECT
+
+public:
+    explicit CameraFrameWorker(QObject* parent = nullptr);
+    ~CameraFrameWorker() override;
+
+    // Any thread
+    void setVideoSource(std::shared_ptr<livekit::VideoSource> source);
+    void setTargetFps(int fps);
+    // Frames submitted while disabled are dropped on arrival
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Any thread: replaces the pending frame and wakes the worker if needed
+    void submit(const QVideoFrame& frame);
+
+    // Clears counters, the pending frame and the once-per-camera format log
+    void reset();
+    // Logs the pixel format path again for the next frame (new camera)
+    void resetFormatLog();
+    CameraFrameStats statistics() const;
+
+signals:
+    // Emitted on the worker thread after each frame reaches the VideoSource
+    void frameSent(int width, int height);
+    void previewReady(const QImage& image);
+
+private:
+    void processPending();
+    void processFrame(QVideoFrame frame);
+
+    // Mapped YUV frame -> tightly packed I420; false for formats without a
+    // planar path
+    static bool convertToI420(const QVideoFrame& frame, std::vector<uint8_t>* out);
+
+    // Local preview is refreshed at most this often on the planar path
+    static constexpr qint64 kPreviewIntervalMs = 66;
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<int> minFrameIntervalMs_{33};
+
+    // Latest-frame mailbox shared with submit()
+    mutable std::mutex mutex_;
+    QVideoFrame pending_;
+    bool hasPending_{false};
+    bool scheduled_{false};
+    std::shared_ptr<livekit::VideoSource> videoSource_;
+    CameraFrameStats stats_;
+    bool loggedPixelFormat_{false};
+
+    // Worker thread only
+    QElapsedTimer clock_;
+    qint64 lastFrameTime_{-1000};
+    qint64 lastPreviewTime_{-1000};
+};
+
+}  // namespace video
+}  // namespace links
+
+#endif  // VIDEO_CAMERA_FRAME_WORKER_H_
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Frame Router
+ */
+
+#ifndef VIDEO_FRAME_ROUTER_H_
+#define VIDEO_FRAME_ROUTER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "video_view_registry.h"
+
+namespace links {
+namespace video {
+
+struct FrameRouterStats {
+    int64_t framesRouted = 0;    // frames handed to route()
+    int64_t deliveries = 0;      // frames handed to a sink
+    int64_t framesUnrouted = 0;  // frames no active sink wanted
+};
+
+// Who gets the frames of which stream. Each sink (a video tile) holds one
+// subscription: a participant, the stream it shows, and its role in the
+// layout ("main", "sidebar", "gallery", ...). Subscriptions change when the
+// layout does; route() runs per frame and only looks up the participant.
+//
+// Sinks showing VideoViewSource::Any get both streams of the participant.
+// Inactive sinks (tiles not on screen) keep their subscription but get no
+// frames. Not thread-safe: subscriptions and routing happen on the thread
+// that owns the sinks.
+template <typename Sink, typename Participant = std::string>
+class FrameRouter {
+public:
+    // Replaces |sink|'s subscription, if any. Updates for the same
+    // participant (visibility, stream switches) are made in place.
+    void subscribe(Sink* sink, const Participant& participant, VideoViewSource source,
+                   const std::string& role, bool active) {
+        const auto owner = participants_.find(sink);
+        if (owner != participants_.end() && owner->second == participant) {
+            for (Subscription& s : subscriptions_[participant]) {
+                if (s.sink == sink) {
+                    if (s.role != role) {
+                        retiredDeliveries_[s.role] += s.delivered;
+                        s.delivered = 0;
+                    }
+                    s.source = source;
+                    s.role = role;
+                    s.active = active;
+                    return;
+                }
+            }
+        }
+        unsubscribe(sink);
+        subscriptions_[participant].push_back(Subscription{sink, source, role, active, 0});
+        participants_.emplace(sink, participant);
+    }
+
+    void unsubscribe(Sink* sink) {
+        const auto owner = participants_.find(sink);
+        if (owner == participants_.end()) {
+            return;
+        }
+        const auto it = subscriptions_.find(owner->second);
+        if (it != subscriptions_.end()) {
+            auto& list = it->second;
+            const auto removed = std::stable_partition(list.begin(), list.end(),
+                                                       [sink](const Subscription& s) { return s.sink != sink; });
+            for (auto s = removed; s != list.end(); ++s) {
+                retiredDeliveries_[s->role] += s->delivered;
+            }
+            list.erase(removed, list.end());
+            if (list.empty()) {
+                subscriptions_.erase(it);
+            }
+        }
+        participants_.erase(owner);
+    }
+
+    // Hands the frame to every active sink subscribed to the participant's
+    // |source| stream through |deliver(Sink*)|. Returns the number of sinks.
+    // Sinks may change subscriptions from inside |deliver|.
+    template <typename Deliver>
+    size_t route(const Participant& participant, VideoViewSource source, Deliver&& deliver) {
+        ++stats_.framesRouted;
+        targets_.clear();
+        const auto it = subscriptions_.find(participant);
+        if (it != subscriptions_.end()) {
+            for (Subscription& s : it->second) {
+                if (s.active && matches(s, source)) {
+                    ++s.delivered;
+                    targets_.push_back(s.sink);
+                }
+            }
+        }
+        if (targets_.empty()) {
+            ++stats_.framesUnrouted;
+            return 0;
+        }
+        const size_t count = targets_.size();
+        stats_.deliveries += static_cast<int64_t>(count);
+        // |targets_| may be reused by a nested route(); iterate over our own
+        std::vector<Sink*> targets;
+        targets.swap(targets_);
+        for (Sink* sink : targets) {
+            deliver(sink);
+        }
+        targets.clear();
+        if (targets_.capacity() < targets.capacity()) {
+            targets_.swap(targets);
+        }
+        return count;
+    }
+
+    // Every sink subscribed to the stream, active or not; used to clear
+    // tiles when the stream ends
+    std::vector<Sink*> subscribers(const Participant& participant, VideoViewSource source) const {
+        std::vector<Sink*> result;
+        const auto it = subscriptions_.find(participant);
+        if (it != subscriptions_.end()) {
+            for (const Subscription& s : it->second) {
+                if (matches(s, source)) {
+                    result.push_back(s.sink);
+                }
+            }
+        }
+        return result;
+    }
+
+    // Frames delivered so far, summed per role
+    std::map<std::string, int64_t> deliveriesByRole() const {
+        std::map<std::string, int64_t> result = retiredDeliveries_;
+        for (const auto& entry : subscriptions_) {
+            for (const Subscription& s : entry.second) {
+                result[s.role] += s.delivered;
+            }
+        }
+        return result;
+    }
+
+    size_t subscriptionCount() const { return participants_.size(); }
+    const FrameRouterStats& stats() const { return stats_; }
+
+private:
+    struct Subscription {
+        Sink* sink;
+        VideoViewSource source;
+        std::string role;
+        bool active;
+        int64_t delivered;
+    };
+
+    static bool matches(const Subscription& s, VideoViewSource source) {
+        return s.source == VideoViewSource::Any || s.source == source;
+    }
+
+    std::map<Participant, std::vector<Subscription>> subscriptions_;
+    std::map<Sink*, Participant> participants_;
+    std::vector<Sink*> targets_;
+    FrameRouterStats stats_;
+    std::map<std::string, int64_t> retiredDeliveries_;  // of ended subscriptions
+};
+
+}  // namespace video
+}  // namespace links
+
+#endif  // VIDEO_FRAME_ROUTER_H_
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Shared I420 Frame
+ */
+
+#include "i420_frame.h"
+
+#include <vector>
+
+#include "video_kernels.h"
+
+namespace links {
+namespace video {
+
+I420FrameRef I420Frame::wrap(int width, int height, const uint8_t* data, std::shared_ptr<const void> owner) {
+    if (width <= 0 || height <= 0 || !data) {
+        return nullptr;
+    }
+    // i420Planes only computes offsets; nothing is written through it
+    const I420Planes planes = i420Planes(const_cast<uint8_t*>(data), width, height);
+
+    std::shared_ptr<I420Frame> frame(new I420Frame());
+    frame->width_ = width;
+    frame->height_ = height;
+    frame->y_ = planes.y;
+    frame->u_ = planes.u;
+    frame->v_ = planes.v;
+    frame->strideY_ = planes.strideY;
+    frame->strideU_ = planes.strideU;
+    frame->strideV_ = planes.strideV;
+    frame->owner_ = std::move(owner);
+    return frame;
+}
+
+I420FrameRef I420Frame::halved(const I420Frame& source) {
+    const int width = (source.width() + 1) / 2;
+    const int height = (source.height() + 1) / 2;
+    auto buffer = std::make_shared<std::vector<uint8_t>>(i420Size(width, height));
+    const I420Planes planes = i420Planes(buffer->data(), width, height);
+
+    kernels::halvePlane(source.y(), source.strideY(), source.width(), source.height(),
+                        planes.y, planes.strideY);
+    kernels::halvePlane(source.u(), source.strideU(), source.chromaWidth(), source.chromaHeight(),
+                        planes.u, planes.strideU);
+    kernels::halvePlane(source.v(), source.strideV(), source.chromaWidth(), source.chromaHeight(),
+                        planes.v, planes.strideV);
+
+    const uint8_t* data = buffer->data();
+    return wrap(width, height, data, std::move(buffer));
+}
+
+}  // namespace video
+}  // namespace links
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Shared I420 Frame
+ */
+
+#ifndef VIDEO_I420_FRAME_H_
+#define VIDEO_I420_FRAME_H_
+
+#include <cstdint>
+#include <memory>
+
+namespace links {
+namespace video {
+
+class I420Frame;
+using I420FrameRef = std::shared_ptr<const I420Frame>;
+
+// Immutable planar 4:2:0 picture that is handed between threads by
+// reference. The pixels are either borrowed from a decoder buffer, kept
+// alive by |owner|, or owned by the frame itself.
+class I420Frame {
+public:
+    // Wraps tightly packed I420 |data| (see i420Planes) without copying
+    static I420FrameRef wrap(int width, int height, const uint8_t* data, std::shared_ptr<const void> owner);
+
+    // New frame of ceil(width / 2) x ceil(height / 2), each plane 2x2
+    // box-filtered from |source|
+    static I420FrameRef halved(const I420Frame& source);
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+    int chromaWidth() const { return (width_ + 1) / 2; }
+    int chromaHeight() const { return (height_ + 1) / 2; }
+
+    const uint8_t* y() const { return y_; }
+    const uint8_t* u() const { return u_; }
+    const uint8_t* v() const { return v_; }
+    int strideY() const { return strideY_; }
+    int strideU() const { return strideU_; }
+    int strideV() const { return strideV_; }
+
+private:
+    I420Frame() = default;
+
+    int width_ = 0;
+    int height_ = 0;
+    const uint8_t* y_ = nullptr;
+    const uint8_t* u_ = nullptr;
+    const uint8_t* v_ = nullptr;
+    int strideY_ = 0;
+    int strideU_ = 0;
+    int strideV_ = 0;
+    std::shared_ptr<const void> owner_;
+};
+
+}  // namespace video
+}  // namespace links
+
+#endif  // VIDEO_I420_FRAME_H_
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Latest Frame Mailbox
+ */
+
+#ifndef VIDEO_LATEST_FRAME_MAILBOX_H_
+#define VIDEO_LATEST_FRAME_MAILBOX_H_
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace links {
+namespace video {
+
+struct FrameMailboxStats {
+    int64_t received = 0;   // frames posted by the producer
+    int64_t delivered = 0;  // frames taken by the consumer
+    int64_t dropped = 0;    // overwritten before the consumer got to them
+};
+
+// Single-slot handoff between a producer thread (stream reader) and a
+// consumer (GUI / render tick). post() overwrites whatever is waiting, so
+// a slow consumer sees only the newest frame and memory stays at one frame
+// per track no matter how far behind it falls.
+//
+// post() reports whether the slot was empty; only then does the producer
+// need to wake the consumer, so at most one wake-up per track is ever
+// queued.
+template <typename Frame>
+class LatestFrameMailbox {
+public:
+    // Producer side. Returns true when the consumer has to be woken.
+    bool post(Frame frame) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.received;
+        const bool wasEmpty = !hasFrame_;
+        if (!wasEmpty) {
+            ++stats_.dropped;
+        }
+        frame_ = std::move(frame);
+        hasFrame_ = true;
+        return wasEmpty;
+    }
+
+    // Consumer side. Moves the newest frame out; false if none is waiting.
+    bool take(Frame* out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!hasFrame_) {
+            return false;
+        }
+        *out = std::move(frame_);
+        frame_ = Frame();
+        hasFrame_ = false;
+        ++stats_.delivered;
+        return true;
+    }
+
+    bool hasFrame() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hasFrame_;
+    }
+
+    FrameMailboxStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    Frame frame_{};
+    bool hasFrame_ = false;
+    FrameMailboxStats stats_;
+};
+
+}  // namespace video
+}  // namespace links
+
+#endif  // VIDEO_LATEST_FRAME_MAILBOX_H_
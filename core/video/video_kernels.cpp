@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Vectorized Pixel Kernels
+ */
+
+#include "video_kernels.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LINKS_VIDEO_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LINKS_VIDEO_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace links {
+namespace video {
+
+size_t i420Size(int width, int height) {
+    const size_t chromaWidth = static_cast<size_t>((width + 1) / 2);
+    const size_t chromaHeight = static_cast<size_t>((height + 1) / 2);
+    return static_cast<size_t>(width) * static_cast<size_t>(height) + 2 * chromaWidth * chromaHeight;
+}
+
+I420Planes i420Planes(uint8_t* data, int width, int height) {
+    const int chromaWidth = (width + 1) / 2;
+    const int chromaHeight = (height + 1) / 2;
+    I420Planes planes;
+    planes.y = data;
+    planes.strideY = width;
+    planes.u = data + static_cast<size_t>(width) * static_cast<size_t>(height);
+    planes.strideU = chromaWidth;
+    planes.v = planes.u + static_cast<size_t>(chromaWidth) * static_cast<size_t>(chromaHeight);
+    planes.strideV = chromaWidth;
+    return planes;
+}
+
+namespace kernels {
+
+namespace {
+
+// Splits |count| interleaved byte pairs into |first| and |second|
+void deinterleavePairs(const uint8_t* src, uint8_t* first, uint8_t* second, int count) {
+    int i = 0;
+#if defined(LINKS_VIDEO_SSE2)
+    const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+    for (; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i + 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first + i),
+                         _mm_packus_epi16(_mm_and_si128(a, lowBytes), _mm_and_si128(b, lowBytes)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(second + i),
+                         _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)));
+    }
+#elif defined(LINKS_VIDEO_NEON)
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16x2_t pairs = vld2q_u8(src + 2 * i);
+        vst1q_u8(first + i, pairs.val[0]);
+        vst1q_u8(second + i, pairs.val[1]);
+    }
+#endif
+    for (; i < count; ++i) {
+        first[i] = src[2 * i];
+        second[i] = src[2 * i + 1];
+    }
+}
+
+// Luma of one packed 4:2:2 row; Y is the even byte for YUYV and the odd
+// byte for UYVY
+template <bool kLumaFirst>
+void extractLuma(const uint8_t* src, uint8_t* dst, int width) {
+    int i = 0;
+#if defined(LINKS_VIDEO_SSE2)
+    const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+    for (; i + 16 <= width; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i + 16));
+        const __m128i lo = kLumaFirst ? _mm_and_si128(a, lowBytes) : _mm_srli_epi16(a, 8);
+        const __m128i hi = kLumaFirst ? _mm_and_si128(b, lowBytes) : _mm_srli_epi16(b, 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(LINKS_VIDEO_NEON)
+    for (; i + 16 <= width; i += 16) {
+        const uint8x16x2_t bytes = vld2q_u8(src + 2 * i);
+        vst1q_u8(dst + i, kLumaFirst ? bytes.val[0] : bytes.val[1]);
+    }
+#endif
+    for (; i < width; ++i) {
+        dst[i] = src[2 * i + (kLumaFirst ? 0 : 1)];
+    }
+}
+
+// Chroma of two packed 4:2:2 rows averaged into one 4:2:0 row of |pairs|
+// samples. U/V sit at bytes 1/3 of each macropixel for YUYV, 0/2 for UYVY.
+template <bool kLumaFirst>
+void averageChroma(const uint8_t* row0, const uint8_t* row1, uint8_t* u, uint8_t* v, int pairs) {
+    int i = 0;
+#if defined(LINKS_VIDEO_SSE2)
+    const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+    for (; i + 8 <= pairs; i += 8) {
+        const __m128i a = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 4 * i)),
+                                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 4 * i)));
+        const __m128i b = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 4 * i + 16)),
+                                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 4 * i + 16)));
+        // U V U V ... for eight macropixels
+        const __m128i chroma = kLumaFirst
+            ? _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8))
+            : _mm_packus_epi16(_mm_and_si128(a, lowBytes), _mm_and_si128(b, lowBytes));
+        const __m128i us = _mm_and_si128(chroma, lowBytes);
+        const __m128i vs = _mm_srli_epi16(chroma, 8);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(u + i), _mm_packus_epi16(us, us));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(v + i), _mm_packus_epi16(vs, vs));
+    }
+#elif defined(LINKS_VIDEO_NEON)
+    for (; i + 8 <= pairs; i += 8) {
+        const uint8x8x4_t top = vld4_u8(row0 + 4 * i);
+        const uint8x8x4_t bottom = vld4_u8(row1 + 4 * i);
+        const int uLane = kLumaFirst ? 1 : 0;
+        const int vLane = kLumaFirst ? 3 : 2;
+        vst1_u8(u + i, vrhadd_u8(top.val[uLane], bottom.val[uLane]));
+        vst1_u8(v + i, vrhadd_u8(top.val[vLane], bottom.val[vLane]));
+    }
+#endif
+    const int uOffset = kLumaFirst ? 1 : 0;
+    for (; i < pairs; ++i) {
+        const int base = 4 * i + uOffset;
+        u[i] = static_cast<uint8_t>((row0[base] + row1[base] + 1) >> 1);
+        v[i] = static_cast<uint8_t>((row0[base + 2] + row1[base + 2] + 1) >> 1);
+    }
+}
+
+template <bool kLumaFirst>
+void packed422ToI420(const uint8_t* src, int srcStride, const I420Planes& dst, int width, int height) {
+    const int pairs = (width + 1) / 2;
+    for (int row = 0; row < height; row += 2) {
+        const uint8_t* row0 = src + static_cast<ptrdiff_t>(row) * srcStride;
+        const bool hasSecondRow = row + 1 < height;
+        // An odd last row is its own chroma partner
+        const uint8_t* row1 = hasSecondRow ? row0 + srcStride : row0;
+
+        uint8_t* luma = dst.y + static_cast<ptrdiff_t>(row) * dst.strideY;
+        extractLuma<kLumaFirst>(row0, luma, width);
+        if (hasSecondRow) {
+            extractLuma<kLumaFirst>(row1, luma + dst.strideY, width);
+        }
+        averageChroma<kLumaFirst>(row0, row1,
+                                  dst.u + static_cast<ptrdiff_t>(row / 2) * dst.strideU,
+                                  dst.v + static_cast<ptrdiff_t>(row / 2) * dst.strideV,
+                                  pairs);
+    }
+}
+
+}  // namespace
+
+void copyPlane(const uint8_t* src, int srcStride, uint8_t* dst, int dstStride, int width, int height) {
+    if (srcStride == width && dstStride == width) {
+        std::memcpy(dst, src, static_cast<size_t>(width) * static_cast<size_t>(height));
+        return;
+    }
+    for (int row = 0; row < height; ++row) {
+        std::memcpy(dst + static_cast<ptrdiff_t>(row) * dstStride,
+                    src + static_cast<ptrdiff_t>(row) * srcStride,
+                    static_cast<size_t>(width));
+    }
+}
+
+void nv12ToI420(const uint8_t* srcY, int srcStrideY,
+                const uint8_t* srcUV, int srcStrideUV,
+                const I420Planes& dst, int width, int height, bool swapUV) {
+    copyPlane(srcY, srcStrideY, dst.y, dst.strideY, width, height);
+
+    const int chromaWidth = (width + 1) / 2;
+    const int chromaHeight = (height + 1) / 2;
+    for (int row = 0; row < chromaHeight; ++row) {
+        uint8_t* u = dst.u + static_cast<ptrdiff_t>(row) * dst.strideU;
+        uint8_t* v = dst.v + static_cast<ptrdiff_t>(row) * dst.strideV;
+        deinterleavePairs(srcUV + static_cast<ptrdiff_t>(row) * srcStrideUV,
+                          swapUV ? v : u, swapUV ? u : v, chromaWidth);
+    }
+}
+
+void yuy2ToI420(const uint8_t* src, int srcStride, const I420Planes& dst, int width, int height) {
+    packed422ToI420<true>(src, srcStride, dst, width, height);
+}
+
+void uyvyToI420(const uint8_t* src, int srcStride, const I420Planes& dst, int width, int height) {
+    packed422ToI420<false>(src, srcStride, dst, width, height);
+}
+
+void halvePlane(const uint8_t* src, int srcStride, int srcWidth, int srcHeight, uint8_t* dst, int dstStride) {
+    const int dstWidth = (srcWidth + 1) / 2;
+    const int dstHeight = (srcHeight + 1) / 2;
+    const int pairs = srcWidth / 2;
+    for (int row = 0; row < dstHeight; ++row) {
+        const uint8_t* row0 = src + static_cast<ptrdiff_t>(2 * row) * srcStride;
+        const uint8_t* row1 = 2 * row + 1 < srcHeight ? row0 + srcStride : row0;
+        uint8_t* out = dst + static_cast<ptrdiff_t>(row) * dstStride;
+        int x = 0;
+#if defined(LINKS_VIDEO_SSE2)
+        // Sixteen outputs per step: average the rows, then each byte pair
+        const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+        for (; x + 16 <= pairs; x += 16) {
+            const __m128i a = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 2 * x)),
+                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 2 * x)));
+            const __m128i b = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 2 * x + 16)),
+                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 2 * x + 16)));
+            const __m128i lo = _mm_avg_epu16(_mm_and_si128(a, lowBytes), _mm_srli_epi16(a, 8));
+            const __m128i hi = _mm_avg_epu16(_mm_and_si128(b, lowBytes), _mm_srli_epi16(b, 8));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), _mm_packus_epi16(lo, hi));
+        }
+#elif defined(LINKS_VIDEO_NEON)
+        for (; x + 16 <= pairs; x += 16) {
+            const uint8x16x2_t top = vld2q_u8(row0 + 2 * x);
+            const uint8x16x2_t bottom = vld2q_u8(row1 + 2 * x);
+            vst1q_u8(out + x, vrhaddq_u8(vrhaddq_u8(top.val[0], bottom.val[0]),
+                                         vrhaddq_u8(top.val[1], bottom.val[1])));
+        }
+#endif
+        for (; x < dstWidth; ++x) {
+            const int left = 2 * x;
+            const int right = left + 1 < srcWidth ? left + 1 : left;
+            out[x] = static_cast<uint8_t>((row0[left] + row0[right] + row1[left] + row1[right] + 2) >> 2);
+        }
+    }
+}
+
+const char* simdBackend() {
+#if defined(LINKS_VIDEO_SSE2)
+    return "sse2";
+#elif defined(LINKS_VIDEO_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+}  // namespace kernels
+}  // namespace video
+}  // namespace links
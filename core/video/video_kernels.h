@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - Vectorized Pixel Kernels
+ */
+
+#ifndef VIDEO_VIDEO_KERNELS_H_
+#define VIDEO_VIDEO_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace links {
+namespace video {
+
+// Destination of a planar 4:2:0 conversion. Chroma planes are
+// ceil(width / 2) x ceil(height / 2).
+struct I420Planes {
+    uint8_t* y = nullptr;
+    int strideY = 0;
+    uint8_t* u = nullptr;
+    int strideU = 0;
+    uint8_t* v = nullptr;
+    int strideV = 0;
+};
+
+// Tightly packed I420 (Y, then U, then V) as LiveKit expects it
+size_t i420Size(int width, int height);
+I420Planes i420Planes(uint8_t* data, int width, int height);
+
+namespace kernels {
+
+// Row-by-row copy of a |width| x |height| byte plane
+void copyPlane(const uint8_t* src, int srcStride, uint8_t* dst, int dstStride, int width, int height);
+
+// NV12 (Y plane + interleaved UV plane) to I420; |swapUV| reads NV21
+void nv12ToI420(const uint8_t* srcY, int srcStrideY,
+                const uint8_t* srcUV, int srcStrideUV,
+                const I420Planes& dst, int width, int height, bool swapUV = false);
+
+// Packed 4:2:2 (YUYV / UYVY) to I420. Chroma of each row pair is averaged
+// with rounding up; |width| is expected to be even.
+void yuy2ToI420(const uint8_t* src, int srcStride, const I420Planes& dst, int width, int height);
+void uyvyToI420(const uint8_t* src, int srcStride, const I420Planes& dst, int width, int height);
+
+// 2x2 box downscale of a byte plane to ceil(srcWidth / 2) x
+// ceil(srcHeight / 2). An odd last column / row is averaged with itself.
+// Results may differ from the exact rounded mean by one.
+void halvePlane(const uint8_t* src, int srcStride, int srcWidth, int srcHeight, uint8_t* dst, int dstStride);
+
+// Name of the instruction set the kernels were built for ("sse2", "neon", "scalar")
+const char* simdBackend();
+
+}  // namespace kernels
+}  // namespace video
+}  // namespace links
+
+#endif  // VIDEO_VIDEO_KERNELS_H_
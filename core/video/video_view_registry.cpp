@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - View Registry
+ */
+
+#include "video_view_registry.h"
+
+#include <algorithm>
+
+namespace links {
+namespace video {
+
+namespace {
+
+// Beyond 8x the decoder should be sending a lower layer instead
+constexpr int kMaxDownscaleSteps = 3;
+
+}  // namespace
+
+VideoViewRegistry& VideoViewRegistry::instance() {
+    static VideoViewRegistry registry;
+    return registry;
+}
+
+void VideoViewRegistry::updateView(const void* view, const std::string& participant, VideoViewSource source,
+                                   bool visible, int width, int height) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    View& entry = views_[view];
+    entry.participant = participant;
+    entry.source = source;
+    entry.visible = visible && width > 0 && height > 0;
+    entry.width = std::max(0, width);
+    entry.height = std::max(0, height);
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void VideoViewRegistry::removeView(const void* view) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (views_.erase(view) > 0) {
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+VideoViewDemand VideoViewRegistry::demand(const std::string& participant, VideoViewSource source) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    VideoViewDemand result;
+    for (const auto& entry : views_) {
+        const View& view = entry.second;
+        if (!view.visible || view.participant != participant) {
+            continue;
+        }
+        if (view.source != VideoViewSource::Any && source != VideoViewSource::Any && view.source != source) {
+            continue;
+        }
+        result.visible = true;
+        result.width = std::max(result.width, view.width);
+        result.height = std::max(result.height, view.height);
+    }
+    return result;
+}
+
+size_t VideoViewRegistry::viewCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return views_.size();
+}
+
+int downscaleSteps(int frameWidth, int frameHeight, const VideoViewDemand& demand) {
+    if (!demand.visible || demand.width <= 0 || demand.height <= 0) {
+        return 0;
+    }
+    int steps = 0;
+    while (steps < kMaxDownscaleSteps
+           && (frameWidth >> (steps + 1)) >= demand.width
+           && (frameHeight >> (steps + 1)) >= demand.height) {
+        ++steps;
+    }
+    return steps;
+}
+
+}  // namespace video
+}  // namespace links
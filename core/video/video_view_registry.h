@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Links Project
+ * Video - View Registry
+ */
+
+#ifndef VIDEO_VIDEO_VIEW_REGISTRY_H_
+#define VIDEO_VIDEO_VIEW_REGISTRY_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace links {
+namespace video {
+
+enum class VideoViewSource {
+    Any,     // shows whichever stream of the participant is routed to it
+    Camera,
+    Screen
+};
+
+// What the views of one remote stream need: whether any of them is on
+// screen, and the largest on-screen size in device pixels
+struct VideoViewDemand {
+    bool visible = false;
+    int width = 0;
+    int height = 0;
+
+    bool operator==(const VideoViewDemand& other) const {
+        return visible == other.visible && width == other.width && height == other.height;
+    }
+    bool operator!=(const VideoViewDemand& other) const { return !(*this == other); }
+};
+
+// Where the UI tells the media pipeline what it actually shows. Video views
+// (QML tiles) report their visibility and pixel size; remote track
+// processing asks for the aggregate demand of a participant's stream and
+// drops or downscales frames accordingly.
+//
+// Thread-safe. generation() changes with every update, so per-frame callers
+// can cache demand() and only re-query after the UI changed something.
+class VideoViewRegistry {
+public:
+    // Shared by the UI and the media pipeline
+    static VideoViewRegistry& instance();
+
+    VideoViewRegistry() = default;
+    VideoViewRegistry(const VideoViewRegistry&) = delete;
+    VideoViewRegistry& operator=(const VideoViewRegistry&) = delete;
+
+    // |view| is an opaque key, typically the address of the view object
+    void updateView(const void* view, const std::string& participant, VideoViewSource source,
+                    bool visible, int width, int height);
+    void removeView(const void* view);
+
+    // Aggregate over the views showing |participant|'s |source| stream,
+    // including views that accept any stream of that participant
+    VideoViewDemand demand(const std::string& participant, VideoViewSource source) const;
+
+    uint64_t generation() const { return generation_.load(std::memory_order_acquire); }
+    size_t viewCount() const;
+
+private:
+    struct View {
+        std::string participant;
+        VideoViewSource source = VideoViewSource::Any;
+        bool visible = false;
+        int width = 0;
+        int height = 0;
+    };
+
+    mutable std::mutex mutex_;
+    std::map<const void*, View> views_;
+    std::atomic<uint64_t> generation_{0};
+};
+
+// Number of 2x downscale steps (0-3) that keep a |frameWidth| x
+// |frameHeight| frame at least as large as the |demand| in both dimensions
+int downscaleSteps(int frameWidth, int frameHeight, const VideoViewDemand& demand);
+
+}  // namespace video
+}  // namespace links
+
+#endif  // VIDEO_VIDEO_VIEW_REGISTRY_H_
@@ -8,7 +8,9 @@
 #include "ui/backend/SettingsBackend.h"
 #include "ui/backend/ConferenceBackend.h"
 #include "ui/backend/VideoRenderer.h"
+#include "ui/backend/LinksVideoItem.h"
 #include "ui/backend/ScreenPickerBackend.h"
+#include "ui/backend/ThumbnailImageProvider.h"
 #include "ui/backend/ShareModeManager.h"
 #include "ui/backend/AuthBackend.h"
 #include "utils/logger.h"
@@ -127,6 +129,7 @@ int main(int argc, char *argv[])
     qmlRegisterType<SettingsBackend>("Links.Backend", 1, 0, "SettingsBackend");
     qmlRegisterType<ConferenceBackend>("Links.Backend", 1, 0, "ConferenceBackend");
     qmlRegisterType<VideoRenderer>("Links.Backend", 1, 0, "VideoRenderer");
+    qmlRegisterType<LinksVideoItem>("Links.Backend", 1, 0, "LinksVideoItem");
     qmlRegisterType<ScreenPickerBackend>("Links.Backend", 1, 0, "ScreenPickerBackend");
     qmlRegisterType<AuthBackend>("Links.Backend", 1, 0, "AuthBackend");
     
@@ -137,6 +140,9 @@ int main(int argc, char *argv[])
     // Add QML import paths for module discovery
     engine.addImportPath("qrc:/");
     
+    // Screen picker thumbnails (engine takes ownership)
+    engine.addImageProvider(ThumbnailCache::kProviderId, new ThumbnailImageProvider());
+    
     // Connection handler for joining conference
     QObject::connect(&engine, &QQmlApplicationEngine::objectCreated,
                      &app, [](QObject *obj, const QUrl &objUrl) {
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "audio/audio_kernels.h"
+#include "audio/audio_mixer.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+std::vector<int16_t> constantFrame(size_t samples, int16_t value) {
+    return std::vector<int16_t>(samples, value);
+}
+
+// Pushes enough 10 ms frames to prime the track
+void pushFrames(AudioMixer::Track& track, int16_t value, int frames, int rate = 48000, int channels = 2) {
+    const size_t perChannel = static_cast<size_t>(rate / 100);
+    const auto frame = constantFrame(perChannel * channels, value);
+    for (int i = 0; i < frames; ++i) {
+        track.push(frame.data(), perChannel, rate, channels);
+    }
+}
+
+}  // namespace
+
+TEST(AudioKernelsTest, AccumulateMatchesScalarReference) {
+    std::vector<int16_t> in(37);
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<int16_t>((static_cast<int>(i) * 1733) % 65536 - 32768);
+    }
+    const int32_t gain = kernels::gainToFixed(0.7f);
+    std::vector<int32_t> acc(in.size(), 5);
+    kernels::accumulateScaled(in.data(), acc.data(), in.size(), gain);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+        const int32_t expected = 5 + ((in[i] * gain + (1 << 13)) >> 14);
+        EXPECT_EQ(acc[i], expected) << "index " << i;
+    }
+}
+
+TEST(AudioKernelsTest, SaturatesOnOverflow) {
+    const std::vector<int32_t> acc = {40000, -40000, 123, -123, 32767, -32768, 70000, -70000, 1};
+    std::vector<int16_t> out(acc.size());
+    kernels::saturateToInt16(acc.data(), out.data(), acc.size());
+    EXPECT_EQ(out[0], 32767);
+    EXPECT_EQ(out[1], -32768);
+    EXPECT_EQ(out[2], 123);
+    EXPECT_EQ(out[3], -123);
+    EXPECT_EQ(out[6], 32767);
+    EXPECT_EQ(out[7], -32768);
+    EXPECT_EQ(out[8], 1);
+}
+
+TEST(AudioMixerTest, SumsTracksWithSaturation) {
+    AudioMixer mixer(48000, 2);
+    auto a = mixer.addTrack("a");
+    auto b = mixer.addTrack("b");
+    pushFrames(*a, 1000, 3);
+    pushFrames(*b, 2500, 3);
+
+    std::vector<int16_t> out(480 * 2);
+    mixer.mix(out.data(), 480);
+    EXPECT_EQ(out[0], 3500);
+    EXPECT_EQ(out[959], 3500);
+
+    auto c = mixer.addTrack("c");
+    pushFrames(*a, 30000, 3);
+    pushFrames(*b, 30000, 3);
+    pushFrames(*c, 30000, 3);
+    mixer.mix(out.data(), 480);  // drains the remaining 1000/2500 frames
+    mixer.mix(out.data(), 480);
+    EXPECT_EQ(out[0], 32767);
+}
+
+TEST(AudioMixerTest, GainAndMuteArePerTrack) {
+    AudioMixer mixer(48000, 1);
+    auto a = mixer.addTrack("a");
+    auto b = mixer.addTrack("b");
+    pushFrames(*a, 1000, 3, 48000, 1);
+    pushFrames(*b, 1000, 3, 48000, 1);
+
+    mixer.setTrackGain("a", 0.5f);
+    mixer.setTrackMuted("b", true);
+
+    std::vector<int16_t> out(480);
+    mixer.mix(out.data(), 480);
+    EXPECT_EQ(out[0], 500);
+
+    // Muted tracks keep draining so they do not build up latency; once
+    // unmuted only the fading concealment of the drained track is left
+    mixer.mix(out.data(), 480);
+    mixer.mix(out.data(), 480);
+    mixer.setTrackMuted("b", false);
+    mixer.setTrackGain("a", 0.0f);
+    mixer.mix(out.data(), 480);
+    EXPECT_LT(out[479], 1000);
+}
+
+TEST(AudioMixerTest, UnprimedTrackIsSilent) {
+    AudioMixer mixer(48000, 2);
+    auto a = mixer.addTrack("a");
+    pushFrames(*a, 1000, 1);  // 10 ms, below the prime threshold
+
+    std::vector<int16_t> out(480 * 2, 7);
+    mixer.mix(out.data(), 480);
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[959], 0);
+}
+
+TEST(AudioMixerTest, ConvertsRateAndChannels) {
+    AudioMixer mixer(48000, 2);
+    auto a = mixer.addTrack("a");
+
+    // 16 kHz mono sine, 100 ms
+    const int inRate = 16000;
+    std::vector<int16_t> in(inRate / 10);
+    for (size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<int16_t>(10000 * std::sin(2.0 * kPi * 440.0 * i / inRate));
+    }
+    for (size_t offset = 0; offset < in.size(); offset += 160) {
+        a->push(in.data() + offset, 160, inRate, 1);
+    }
+
+    std::vector<int16_t> out(4800 * 2);
+    mixer.mix(out.data(), 4800);
+    // Both channels carry the same upsampled signal, delayed by one input sample
+    double maxError = 0.0;
+    for (size_t frame = 10; frame < 4700; ++frame) {
+        EXPECT_EQ(out[frame * 2], out[frame * 2 + 1]);
+        const double expected = 10000 * std::sin(2.0 * kPi * 440.0 * (frame - 3.0) / 48000.0);
+        maxError = std::max(maxError, std::fabs(out[frame * 2] - expected));
+    }
+    EXPECT_LT(maxError, 500.0);
+}
+
+TEST(AudioMixerTest, RemoveTrack) {
+    AudioMixer mixer;
+    mixer.addTrack("a");
+    mixer.addTrack("b");
+    EXPECT_EQ(mixer.addTrack("a"), mixer.track("a"));
+    EXPECT_EQ(mixer.trackCount(), 2u);
+    mixer.removeTrack("a");
+    EXPECT_EQ(mixer.trackCount(), 1u);
+    EXPECT_EQ(mixer.track("a"), nullptr);
+}
+
+// Control calls on another thread while the output keeps pulling; mix()
+// works from a snapshot, so a removed track finishes the mix it is in
+TEST(AudioMixerTest, TrackListChangesWhileMixing) {
+    AudioMixer mixer;
+    pushFrames(*mixer.addTrack("steady"), 1000, 20);
+
+    std::atomic<bool> done{false};
+    std::thread control([&mixer, &done]() {
+        for (int i = 0; i < 500; ++i) {
+            const std::string id = "t" + std::to_string(i % 4);
+            pushFrames(*mixer.addTrack(id), 500, 2);
+            mixer.setTrackGain(id, 0.5f);
+            mixer.setTrackMuted("steady", i % 2 == 0);
+            mixer.removeTrack(id);
+        }
+        done.store(true);
+    });
+
+    std::vector<int16_t> out(480 * 2);
+    int mixes = 0;
+    while (!done.load() || mixes < 100) {
+        mixer.mix(out.data(), 480);
+        ++mixes;
+    }
+    control.join();
+
+    EXPECT_EQ(mixer.trackCount(), 1u);
+    EXPECT_NE(mixer.track("steady"), nullptr);
+}
+
+}  // namespace audio
+}  // namespace links
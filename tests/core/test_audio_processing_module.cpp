@@ -2,6 +2,9 @@
 #include <cmath>
 #include <gtest/gtest.h>
 #include "core/audio_processing_module.h"
+#include "core/audio/render_reference_tap.h"
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 // =============================================================================
@@ -185,3 +188,146 @@ TEST_F(AudioProcessingModuleTest, MoveSemantics) {
     apm3 = std::move(apm2);
     EXPECT_TRUE(apm3.isInitialized());
 }
+
+// Test: Render frames are accepted and the stream delay is smoothed
+TEST_F(AudioProcessingModuleTest, RenderFrameAndStreamDelay) {
+    auto audio = generateSineWave(960, 48000, 440);
+    EXPECT_FALSE(apm.processRenderFrame(audio.data(), 480, 48000, 2));
+    
+    ASSERT_TRUE(apm.initialize());
+    EXPECT_TRUE(apm.processRenderFrame(audio.data(), 480, 48000, 2));
+    EXPECT_FALSE(apm.processRenderFrame(nullptr, 480, 48000, 2));
+    
+    // A single update only moves part of the way towards the new delay
+    apm.setRenderDelayMs(80);
+    EXPECT_GT(apm.streamDelayMs(), 0);
+    EXPECT_LT(apm.streamDelayMs(), 80);
+    
+    for (int i = 0; i < 100; ++i) {
+        apm.setRenderDelayMs(80);
+        apm.setCaptureDelayMs(20);
+    }
+    EXPECT_EQ(apm.streamDelayMs(), 100);
+    
+    // Clamped to what APM accepts
+    for (int i = 0; i < 100; ++i) {
+        apm.setRenderDelayMs(2000);
+    }
+    EXPECT_EQ(apm.streamDelayMs(), 500);
+}
+
+// Test: The tap regroups device pulls of any size into 10ms render frames
+TEST_F(AudioProcessingModuleTest, RenderTapRegroupsIntoTenMsFrames) {
+    ASSERT_TRUE(apm.initialize());
+    links::audio::RenderReferenceTap tap;
+    tap.configure(48000, 2);
+    
+    std::vector<int16_t> chunk(2048 * 2, 1000);
+    tap.write(chunk.data(), 480, 0);
+    EXPECT_EQ(tap.framesForwarded(), 0);  // no processor attached yet
+    
+    tap.setProcessor(&apm);
+    EXPECT_TRUE(tap.hasProcessor());
+    
+    const size_t pulls[] = {441, 1024, 480, 37, 2048, 970};
+    size_t total = 0;
+    for (size_t frames : pulls) {
+        tap.write(chunk.data(), frames, 40);
+        total += frames;
+    }
+    EXPECT_EQ(tap.framesForwarded(), static_cast<int64_t>(total / 480));
+    EXPECT_GT(apm.streamDelayMs(), 0);
+    
+    tap.setProcessor(nullptr);
+    EXPECT_FALSE(tap.hasProcessor());
+}
+
+// Test: Output at a rate APM cannot take (44.1kHz) is converted, not rejected
+TEST_F(AudioProcessingModuleTest, RenderTapResamples44100ToApmRate) {
+    ASSERT_TRUE(apm.initialize());
+    EXPECT_FALSE(links::audio::RenderReferenceTap::isProcessingRate(44100));
+    
+    links::audio::RenderReferenceTap tap;
+    tap.configure(44100, 2);
+    tap.setProcessor(&apm);
+    
+    // One second of a 1kHz tone in device-sized pulls, one longer than the
+    // tap converts at once
+    constexpr int kRate = 44100;
+    std::vector<int16_t> render(kRate * 2);
+    for (int i = 0; i < kRate; ++i) {
+        const auto sample = static_cast<int16_t>(8000.0 * std::sin(2.0 * M_PI * 1000.0 * i / kRate));
+        render[i * 2] = sample;
+        render[i * 2 + 1] = sample;
+    }
+    const size_t pulls[] = {441, 1024, 4410, 37, 2048, 512};
+    size_t written = 0;
+    for (size_t i = 0; written < static_cast<size_t>(kRate); ++i) {
+        const size_t frames = std::min(pulls[i % 6], kRate - written);
+        tap.write(render.data() + written * 2, frames, 40);
+        written += frames;
+    }
+    
+    // 100 frames of 10ms at 48kHz, less at most one held back by the
+    // resampler or still pending
+    EXPECT_GE(tap.framesForwarded(), 98);
+    EXPECT_LE(tap.framesForwarded(), 100);
+    EXPECT_EQ(tap.framesRejected(), 0);
+}
+
+// Test: A delayed, attenuated copy of the render signal is cancelled
+TEST_F(AudioProcessingModuleTest, EchoIsCancelledFromRenderReference) {
+    ASSERT_TRUE(apm.initialize());
+    apm.setNoiseSuppressionEnabled(false);
+    apm.setAutoGainControlEnabled(false);
+    
+    constexpr int kRate = 48000;
+    constexpr int kFrame = kRate / 100;
+    constexpr int kEchoDelayMs = 40;
+    constexpr int kEchoDelaySamples = kRate / 1000 * kEchoDelayMs;
+    constexpr int kSeconds = 10;
+    constexpr int kMeasuredSeconds = 3;
+    
+    // Deterministic broadband far-end signal
+    const int totalSamples = kRate * kSeconds;
+    std::vector<int16_t> render(totalSamples);
+    uint32_t seed = 12345;
+    for (int i = 0; i < totalSamples; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        render[i] = static_cast<int16_t>(static_cast<int32_t>(seed >> 16) % 8000 - 4000);
+    }
+    
+    double echoEnergy = 0;
+    double residualEnergy = 0;
+    std::vector<int16_t> renderFrame(kFrame);
+    std::vector<int16_t> captureFrame(kFrame);
+    for (int start = 0; start + kFrame <= totalSamples; start += kFrame) {
+        std::copy(render.begin() + start, render.begin() + start + kFrame, renderFrame.begin());
+        for (int i = 0; i < kFrame; ++i) {
+            const int source = start + i - kEchoDelaySamples;
+            captureFrame[i] = source >= 0 ? static_cast<int16_t>(render[source] / 2) : 0;
+        }
+        
+        const bool measured = start >= kRate * (kSeconds - kMeasuredSeconds);
+        if (measured) {
+            for (int16_t sample : captureFrame) {
+                echoEnergy += static_cast<double>(sample) * sample;
+            }
+        }
+        
+        apm.setRenderDelayMs(kEchoDelayMs);
+        ASSERT_TRUE(apm.processRenderFrame(renderFrame.data(), kFrame, kRate, 1));
+        ASSERT_TRUE(apm.processFrame(captureFrame.data(), kFrame, kRate, 1));
+        
+        if (measured) {
+            for (int16_t sample : captureFrame) {
+                residualEnergy += static_cast<double>(sample) * sample;
+            }
+        }
+    }
+    
+    ASSERT_GT(echoEnergy, 0.0);
+    const double erleDb = 10.0 * std::log10(echoEnergy / std::max(residualEnergy, 1.0));
+    EXPECT_GT(erleDb, 10.0);
+    EXPECT_EQ(apm.streamDelayMs(), kEchoDelayMs);
+}
@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "audio/audio_kernels.h"
+#include "audio/audio_resampler.h"
+#include "audio/capture_converter.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr int kOutputRate = 48000;
+
+// Resamples a tone in odd-sized chunks and returns the output
+std::vector<float> resampleTone(int inputRate, double frequency, double seconds) {
+    PolyphaseResampler resampler(inputRate, kOutputRate);
+    const size_t total = static_cast<size_t>(inputRate * seconds);
+    std::vector<float> input(total);
+    for (size_t i = 0; i < total; ++i) {
+        input[i] = static_cast<float>(10000.0 * std::sin(2.0 * kPi * frequency * i / inputRate));
+    }
+
+    std::vector<float> output;
+    std::vector<float> chunkOut(resampler.maxOutputFrames(733));
+    for (size_t offset = 0; offset < total; offset += 733) {
+        const size_t count = std::min<size_t>(733, total - offset);
+        const size_t produced = resampler.process(input.data() + offset, count, chunkOut.data());
+        output.insert(output.end(), chunkOut.begin(), chunkOut.begin() + produced);
+    }
+    return output;
+}
+
+// Signal-to-error ratio of |output| against the ideal tone at the output rate,
+// skipping the filter's start-up region
+double snrDb(const std::vector<float>& output, double frequency) {
+    double signal = 0.0;
+    double error = 0.0;
+    for (size_t n = 1000; n < output.size(); ++n) {
+        const double ideal = 10000.0 * std::sin(2.0 * kPi * frequency * n / kOutputRate);
+        signal += ideal * ideal;
+        error += (output[n] - ideal) * (output[n] - ideal);
+    }
+    return 10.0 * std::log10(signal / std::max(error, 1e-9));
+}
+
+double rms(const std::vector<float>& samples, size_t skip) {
+    double sum = 0.0;
+    for (size_t n = skip; n < samples.size(); ++n) {
+        sum += static_cast<double>(samples[n]) * samples[n];
+    }
+    return std::sqrt(sum / static_cast<double>(samples.size() - skip));
+}
+
+}  // namespace
+
+TEST(AudioKernelsTest, FloatConversionsRoundAndSaturate) {
+    const float in[10] = {0.4f, 0.6f, -0.6f, 1.5f, 2.5f, 40000.0f, -40000.0f, 32767.4f, -32768.0f, 100.0f};
+    int16_t out[10];
+    kernels::floatToInt16(in, out, 10);
+    const int16_t expected[10] = {0, 1, -1, 2, 2, INT16_MAX, INT16_MIN, INT16_MAX, INT16_MIN, 100};
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(out[i], expected[i]) << "index " << i;
+    }
+
+    const int16_t samples[11] = {0, 1, -1, INT16_MAX, INT16_MIN, 1234, -4321, 7, 8, 9, -10};
+    float converted[11];
+    kernels::int16ToFloat(samples, converted, 11);
+    for (int i = 0; i < 11; ++i) {
+        EXPECT_FLOAT_EQ(converted[i], static_cast<float>(samples[i]));
+    }
+}
+
+TEST(AudioKernelsTest, DownmixAndDotProductMatchScalar) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> dist(-1000.0f, 1000.0f);
+    for (int channels : {1, 2, 3, 6}) {
+        const size_t frames = 37;
+        std::vector<float> in(frames * channels);
+        for (auto& sample : in) {
+            sample = dist(rng);
+        }
+        std::vector<float> out(frames);
+        kernels::downmixToMono(in.data(), out.data(), frames, channels);
+        for (size_t f = 0; f < frames; ++f) {
+            float sum = 0.0f;
+            for (int c = 0; c < channels; ++c) {
+                sum += in[f * channels + c];
+            }
+            EXPECT_NEAR(out[f], sum / channels, 1e-3f);
+        }
+    }
+
+    std::vector<float> a(101);
+    std::vector<float> b(101);
+    double expected = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = dist(rng);
+        b[i] = dist(rng) / 1000.0f;
+        expected += static_cast<double>(a[i]) * b[i];
+    }
+    EXPECT_NEAR(kernels::dotProduct(a.data(), b.data(), a.size()), expected, 1e-2);
+}
+
+TEST(AudioKernelsTest, CrossfadeRampsMonotonicallyBetweenSources) {
+    constexpr size_t kCount = 240;
+    std::vector<int16_t> from(kCount, 10000);
+    std::vector<int16_t> to(kCount, -10000);
+    std::vector<int16_t> out(kCount);
+    kernels::crossfade(from.data(), to.data(), out.data(), kCount);
+
+    EXPECT_LT(out.front(), 10000);
+    EXPECT_GT(out.front(), 9800);
+    EXPECT_GT(out.back(), -10000);
+    EXPECT_LT(out.back(), -9800);
+    EXPECT_NEAR(out[kCount / 2], 0, 100);
+    for (size_t i = 1; i < kCount; ++i) {
+        EXPECT_LE(out[i], out[i - 1]) << "index " << i;
+    }
+
+    // Aliasing the output onto the first input
+    kernels::crossfade(from.data(), to.data(), from.data(), kCount);
+    EXPECT_EQ(from, out);
+}
+
+TEST(PolyphaseResamplerTest, PassthroughAtEqualRates) {
+    PolyphaseResampler resampler(kOutputRate, kOutputRate);
+    EXPECT_TRUE(resampler.isPassthrough());
+    const float in[3] = {1.0f, -2.0f, 3.0f};
+    float out[3] = {};
+    ASSERT_EQ(resampler.process(in, 3, out), 3u);
+    EXPECT_FLOAT_EQ(out[1], -2.0f);
+}
+
+TEST(PolyphaseResamplerTest, ToneQualityAcrossCommonDeviceRates) {
+    // 11025 Hz needs more phases than are stored and uses the nearest one
+    const struct {
+        int rate;
+        double minSnrDb;
+    } cases[] = {{8000, 70.0}, {11025, 55.0}, {16000, 70.0}, {22050, 70.0}, {32000, 70.0},
+                 {44100, 70.0}, {88200, 70.0}, {96000, 70.0}, {192000, 70.0}};
+
+    for (const auto& c : cases) {
+        const auto output = resampleTone(c.rate, 1000.0, 1.0);
+        // Output length tracks the rate ratio (minus the filter lookahead)
+        EXPECT_NEAR(static_cast<double>(output.size()), kOutputRate, 200.0) << c.rate;
+        EXPECT_GT(snrDb(output, 1000.0), c.minSnrDb) << c.rate;
+    }
+}
+
+TEST(PolyphaseResamplerTest, DownsamplingRejectsAliases) {
+    // 30 kHz cannot be represented at 48 kHz and would fold to 18 kHz
+    const auto output = resampleTone(96000, 30000.0, 0.5);
+    const double level = 20.0 * std::log10(rms(output, 1000) / (10000.0 / std::sqrt(2.0)));
+    EXPECT_LT(level, -60.0);
+}
+
+TEST(PolyphaseResamplerTest, ConstantInputStaysConstant) {
+    PolyphaseResampler resampler(44100, kOutputRate);
+    std::vector<float> in(4410, 5000.0f);
+    std::vector<float> out(resampler.maxOutputFrames(in.size()));
+    const size_t produced = resampler.process(in.data(), in.size(), out.data());
+    ASSERT_GT(produced, 4000u);
+    for (size_t n = resampler.tapsPerPhase(); n < produced; ++n) {
+        ASSERT_NEAR(out[n], 5000.0f, 0.5f) << n;
+    }
+}
+
+TEST(CaptureConverterTest, Int16MonoAt48kIsPassedThrough) {
+    CaptureConverter converter;
+    ASSERT_TRUE(converter.configure(kOutputRate, 1, SampleFormat::Int16));
+    EXPECT_TRUE(converter.isPassthrough());
+    const int16_t in[4] = {1, -2, 3, INT16_MIN};
+    int16_t out[4] = {};
+    ASSERT_EQ(converter.process(in, 4, out), 4u);
+    EXPECT_EQ(out[3], INT16_MIN);
+}
+
+TEST(CaptureConverterTest, FloatStereo44kBecomesInt16Mono48k) {
+    CaptureConverter converter;
+    ASSERT_TRUE(converter.configure(44100, 2, SampleFormat::Float, 1024));
+    EXPECT_FALSE(converter.isPassthrough());
+    EXPECT_EQ(converter.bytesPerFrame(), 8u);
+
+    // Left and right carry the same 0.25 full-scale tone, opposite DC offsets
+    std::vector<int16_t> output;
+    std::vector<float> chunk(441 * 2);
+    std::vector<int16_t> converted(converter.maxOutputFrames(441));
+    size_t frame = 0;
+    for (int block = 0; block < 100; ++block) {
+        for (size_t i = 0; i < 441; ++i, ++frame) {
+            const float tone = 0.25f * static_cast<float>(std::sin(2.0 * kPi * 440.0 * frame / 44100.0));
+            chunk[i * 2] = tone + 0.1f;
+            chunk[i * 2 + 1] = tone - 0.1f;
+        }
+        const size_t produced = converter.process(chunk.data(), 441, converted.data());
+        output.insert(output.end(), converted.begin(), converted.begin() + produced);
+    }
+
+    EXPECT_NEAR(static_cast<double>(output.size()), 48000.0, 100.0);
+    const int16_t peak = *std::max_element(output.begin() + 1000, output.end());
+    EXPECT_NEAR(peak, 8192, 20);
+}
+
+TEST(CaptureConverterTest, IntegerFormatsUseInt16Scale) {
+    CaptureConverter converter;
+    ASSERT_TRUE(converter.configure(kOutputRate, 1, SampleFormat::Int32));
+    std::vector<int32_t> in32(480, 1000 * 65536);
+    std::vector<int16_t> out(converter.maxOutputFrames(480));
+    const size_t produced = converter.process(in32.data(), 480, out.data());
+    ASSERT_EQ(produced, 480u);
+    EXPECT_EQ(out[100], 1000);
+
+    ASSERT_TRUE(converter.configure(kOutputRate, 1, SampleFormat::UInt8));
+    std::vector<uint8_t> in8(480, 192);
+    converter.process(in8.data(), 480, out.data());
+    EXPECT_EQ(out[100], 64 * 256);
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "audio/audio_ring_buffer.h"
+
+// =============================================================================
+// Allocation counting (global operator new hook, active only while armed)
+// =============================================================================
+
+namespace {
+
+std::atomic<bool> g_countAllocations{false};
+std::atomic<int64_t> g_allocationCount{0};
+
+class AllocationCounter {
+public:
+    AllocationCounter() {
+        g_allocationCount.store(0);
+        g_countAllocations.store(true);
+    }
+    ~AllocationCounter() { g_countAllocations.store(false); }
+
+    int64_t count() const { return g_allocationCount.load(); }
+};
+
+}  // namespace
+
+// GCC inlines these into the tests and then flags free() on memory from
+// operator new; both sides are the malloc-backed pair below, so the
+// diagnostic is a false positive
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    if (g_countAllocations.load(std::memory_order_relaxed)) {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace links {
+namespace audio {
+
+TEST(AudioRingBufferTest, CapacityRoundsUpToPowerOfTwo) {
+    AudioRingBuffer ring(1000);
+    EXPECT_EQ(ring.capacity(), 1024u);
+    EXPECT_EQ(ring.available(), 0u);
+    EXPECT_EQ(ring.freeSpace(), 1024u);
+}
+
+TEST(AudioRingBufferTest, WriteReadAcrossWrap) {
+    AudioRingBuffer ring(8);
+    std::vector<int16_t> in(6);
+    std::iota(in.begin(), in.end(), 1);
+
+    ASSERT_EQ(ring.write(in.data(), in.size()), 6u);
+    int16_t out[6] = {};
+    ASSERT_EQ(ring.read(out, 4), 4u);
+
+    // Next write wraps around the physical end of the buffer
+    ASSERT_EQ(ring.write(in.data(), in.size()), 6u);
+    EXPECT_EQ(ring.available(), 8u);
+    EXPECT_EQ(ring.freeSpace(), 0u);
+
+    ASSERT_EQ(ring.read(out, 2), 2u);
+    EXPECT_EQ(out[0], 5);
+    EXPECT_EQ(out[1], 6);
+    ASSERT_EQ(ring.read(out, 6), 6u);
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(out[i], in[i]);
+    }
+}
+
+TEST(AudioRingBufferTest, WriteIsClampedWhenFull) {
+    AudioRingBuffer ring(4);
+    int16_t in[6] = {1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(ring.write(in, 6), 4u);
+    EXPECT_EQ(ring.write(in, 1), 0u);
+}
+
+TEST(AudioRingBufferTest, ContiguousReadUsesScratchOnlyWhenWrapped) {
+    AudioRingBuffer ring(8);
+    int16_t in[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    int16_t scratch[4] = {};
+
+    ring.write(in, 4);
+    const int16_t* direct = ring.contiguousRead(4, scratch);
+    ASSERT_NE(direct, nullptr);
+    EXPECT_NE(direct, scratch);
+    EXPECT_EQ(direct[3], 4);
+    ring.consume(4);
+
+    ring.write(in, 6);  // occupies slots 4..7 then 0..1
+    ring.consume(2);
+    const int16_t* wrapped = ring.contiguousRead(4, scratch);
+    ASSERT_EQ(wrapped, scratch);
+    EXPECT_EQ(wrapped[0], 3);
+    EXPECT_EQ(wrapped[3], 6);
+
+    EXPECT_EQ(ring.contiguousRead(5, scratch), nullptr);
+}
+
+TEST(AudioRingBufferTest, ConcurrentProducerConsumerPreservesOrder) {
+    AudioRingBuffer ring(256);
+    constexpr int kTotal = 100000;
+
+    std::thread producer([&ring]() {
+        int16_t value = 0;
+        int written = 0;
+        while (written < kTotal) {
+            auto span = ring.writableSpan(37);
+            for (size_t i = 0; i < span.firstSize; ++i) {
+                span.first[i] = value++;
+            }
+            for (size_t i = 0; i < span.secondSize; ++i) {
+                span.second[i] = value++;
+            }
+            ring.commitWrite(span.size());
+            written += static_cast<int>(span.size());
+            if (span.size() == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int16_t expected = 0;
+    int received = 0;
+    bool ordered = true;
+    int16_t chunk[64];
+    while (received < kTotal) {
+        const size_t n = ring.read(chunk, 64);
+        for (size_t i = 0; i < n; ++i) {
+            ordered = ordered && (chunk[i] == expected);
+            ++expected;
+        }
+        received += static_cast<int>(n);
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+}
+
+// The ring operations a capture loop is built from: writes of varying size
+// straight into the ring, and 10 ms frames copied out into one preallocated
+// frame. Only the ring is covered here; AudioCaptureWorker itself needs a
+// QAudioSource and a LiveKit source and is exercised by the microphone
+// capturer tests.
+TEST(AudioRingBufferTest, FramingLoopDoesNotAllocate) {
+    constexpr size_t kFrameSamples = 480;
+    const size_t deviceChunks[] = {441, 512, 480, 1024, 128, 960};
+
+    AudioRingBuffer ring(48000 / 5);
+    std::vector<int16_t> frame(kFrameSamples);
+    std::vector<int16_t> scratch(kFrameSamples);
+    int16_t nextSample = 0;
+    int64_t framesSent = 0;
+    int64_t checksum = 0;
+
+    AllocationCounter counter;
+    for (int iteration = 0; iteration < 2000; ++iteration) {
+        const size_t chunk = deviceChunks[iteration % 6];
+        auto span = ring.writableSpan(chunk);
+        for (size_t i = 0; i < span.firstSize; ++i) {
+            span.first[i] = nextSample++;
+        }
+        for (size_t i = 0; i < span.secondSize; ++i) {
+            span.second[i] = nextSample++;
+        }
+        ring.commitWrite(span.size());
+
+        while (ring.available() >= kFrameSamples) {
+            if (framesSent % 2 == 0) {
+                ring.read(frame.data(), kFrameSamples);
+                checksum += frame[0];
+            } else {
+                const int16_t* data = ring.contiguousRead(kFrameSamples, scratch.data());
+                checksum += data[0];
+                ring.consume(kFrameSamples);
+            }
+            ++framesSent;
+        }
+    }
+
+    EXPECT_EQ(counter.count(), 0);
+    EXPECT_GT(framesSent, 2000);
+    EXPECT_NE(checksum, 0);
+}
+
+}  // namespace audio
+}  // namespace links
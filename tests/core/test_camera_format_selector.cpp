@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "video/camera_format_selector.h"
+
+namespace links {
+namespace video {
+
+namespace {
+
+CameraMode mode(int width, int height, float maxFps, CameraEncoding encoding) {
+    CameraMode m;
+    m.width = width;
+    m.height = height;
+    m.minFps = 5.0f;
+    m.maxFps = maxFps;
+    m.encoding = encoding;
+    return m;
+}
+
+// A typical USB 2.0 webcam: raw YUYV is only fast at small sizes
+std::vector<CameraMode> usbWebcamModes() {
+    return {
+        mode(1920, 1080, 5.0f, CameraEncoding::RawYuv),
+        mode(1280, 720, 10.0f, CameraEncoding::RawYuv),
+        mode(640, 480, 30.0f, CameraEncoding::RawYuv),
+        mode(320, 240, 30.0f, CameraEncoding::RawYuv),
+        mode(1920, 1080, 30.0f, CameraEncoding::Mjpeg),
+        mode(1280, 720, 30.0f, CameraEncoding::Mjpeg),
+        mode(640, 480, 30.0f, CameraEncoding::Mjpeg),
+    };
+}
+
+}  // namespace
+
+TEST(CameraFormatSelectorTest, EmptyListHasNoMode) {
+    EXPECT_EQ(selectCameraMode({}, captureProfile(CameraQuality::Standard)), -1);
+}
+
+TEST(CameraFormatSelectorTest, PrefersRawYuvWhenItMeetsTheTarget) {
+    const auto modes = usbWebcamModes();
+    const int index = selectCameraMode(modes, captureProfile(CameraQuality::Standard));
+    ASSERT_GE(index, 0);
+    EXPECT_EQ(modes[index].width, 640);
+    EXPECT_EQ(modes[index].encoding, CameraEncoding::RawYuv);
+}
+
+TEST(CameraFormatSelectorTest, FallsBackToMjpegWhenRawCannotKeepUp) {
+    const auto modes = usbWebcamModes();
+    const int index = selectCameraMode(modes, captureProfile(CameraQuality::High));
+    ASSERT_GE(index, 0);
+    EXPECT_EQ(modes[index].width, 1280);
+    EXPECT_EQ(modes[index].height, 720);
+    EXPECT_EQ(modes[index].encoding, CameraEncoding::Mjpeg);
+}
+
+TEST(CameraFormatSelectorTest, NeverPicksMaximumResolutionForSmallTargets) {
+    const auto modes = usbWebcamModes();
+    const CaptureProfile low = captureProfile(CameraQuality::Low);
+    const int index = selectCameraMode(modes, low);
+    ASSERT_GE(index, 0);
+    EXPECT_EQ(modes[index].width, 320);
+    EXPECT_GE(modes[index].maxFps, static_cast<float>(low.fps));
+}
+
+TEST(CameraFormatSelectorTest, PrefersDownscalingOverUpscaling) {
+    const std::vector<CameraMode> modes = {
+        mode(480, 360, 30.0f, CameraEncoding::RawYuv),
+        mode(800, 600, 30.0f, CameraEncoding::RawYuv),
+    };
+    const int index = selectCameraMode(modes, {640, 480, 30});
+    ASSERT_GE(index, 0);
+    EXPECT_EQ(modes[index].width, 800);
+}
+
+TEST(CameraFormatSelectorTest, AcceptsNtscFrameRates) {
+    const std::vector<CameraMode> modes = {
+        mode(640, 480, 29.97f, CameraEncoding::RawYuv),
+        mode(640, 480, 60.0f, CameraEncoding::Mjpeg),
+    };
+    const int index = selectCameraMode(modes, {640, 480, 30});
+    ASSERT_GE(index, 0);
+    EXPECT_EQ(modes[index].encoding, CameraEncoding::RawYuv);
+}
+
+TEST(CameraFormatSelectorTest, QualityNamesRoundTrip) {
+    for (CameraQuality quality : {CameraQuality::Low, CameraQuality::Standard, CameraQuality::High}) {
+        CameraQuality parsed = CameraQuality::Standard;
+        EXPECT_TRUE(parseQuality(qualityName(quality), &parsed));
+        EXPECT_EQ(parsed, quality);
+    }
+    CameraQuality unchanged = CameraQuality::High;
+    EXPECT_FALSE(parseQuality("ultra", &unchanged));
+    EXPECT_EQ(unchanged, CameraQuality::High);
+}
+
+}  // namespace video
+}  // namespace links
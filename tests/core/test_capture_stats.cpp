@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include "audio/capture_stats.h"
+
+namespace links {
+namespace audio {
+
+TEST(CaptureStatsTest, SteadyCallbacksHaveNoJitter) {
+    CaptureStats stats(48000);
+    // 10 ms of audio every 10 ms
+    for (int i = 0; i < 100; ++i) {
+        stats.onDeviceData(i * 10000, 480);
+    }
+
+    const auto snapshot = stats.snapshot();
+    EXPECT_EQ(snapshot.callbacks, 100);
+    EXPECT_DOUBLE_EQ(snapshot.meanCallbackIntervalMs, 10.0);
+    EXPECT_DOUBLE_EQ(snapshot.maxCallbackIntervalMs, 10.0);
+    EXPECT_NEAR(snapshot.jitterMs, 0.0, 1e-9);
+}
+
+TEST(CaptureStatsTest, LateCallbackRaisesJitterAndMaxInterval) {
+    CaptureStats stats(48000);
+    int64_t now = 0;
+    for (int i = 0; i < 50; ++i) {
+        stats.onDeviceData(now, 480);
+        now += 10000;
+    }
+    // The thread was stalled for 40 ms, then the device hands over 40 ms at once
+    now += 30000;
+    stats.onDeviceData(now, 480);
+    now += 1000;
+    stats.onDeviceData(now, 1920);
+
+    const auto snapshot = stats.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot.maxCallbackIntervalMs, 40.0);
+    EXPECT_GT(snapshot.jitterMs, 1.0);
+}
+
+TEST(CaptureStatsTest, ProcessingTimeAndBudget) {
+    CaptureStats stats(48000);
+    stats.onFrameProcessed(1000, 10000);
+    stats.onFrameProcessed(3000, 10000);
+    stats.onFrameProcessed(12000, 10000);
+
+    const auto snapshot = stats.snapshot();
+    EXPECT_EQ(snapshot.framesProcessed, 3);
+    EXPECT_DOUBLE_EQ(snapshot.meanProcessingUs, 16000.0 / 3);
+    EXPECT_DOUBLE_EQ(snapshot.maxProcessingUs, 12000.0);
+    EXPECT_EQ(snapshot.framesOverBudget, 1);
+}
+
+TEST(CaptureStatsTest, OverrunsAndReset) {
+    CaptureStats stats(48000);
+    stats.onOverrun(480);
+    stats.onOverrun(100);
+    EXPECT_EQ(stats.snapshot().overruns, 2);
+    EXPECT_EQ(stats.snapshot().droppedSamples, 580);
+
+    stats.reset(16000);
+    const auto snapshot = stats.snapshot();
+    EXPECT_EQ(snapshot.overruns, 0);
+    EXPECT_EQ(snapshot.callbacks, 0);
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "desktop_capture/desktop_frame.h"
+#include "desktop_capture/frame_differ.h"
+
+namespace links {
+namespace desktop_capture {
+
+namespace {
+
+std::vector<DesktopRect> diff(const DesktopFrame& previous, const DesktopFrame& current, int blockSize) {
+    return findUpdatedRects(previous.data(), previous.stride(), current.data(), current.stride(),
+                            current.size(), blockSize);
+}
+
+void touch(DesktopFrame& frame, int x, int y) {
+    frame.dataAt(DesktopVector(x, y))[1] ^= 0xFF;
+}
+
+}  // namespace
+
+TEST(FrameDifferTest, IdenticalFramesHaveNoUpdates) {
+    BasicDesktopFrame previous(DesktopSize(64, 48));
+    BasicDesktopFrame current(DesktopSize(64, 48));
+    EXPECT_TRUE(diff(previous, current, 16).empty());
+}
+
+TEST(FrameDifferTest, SinglePixelMarksItsBlock) {
+    BasicDesktopFrame previous(DesktopSize(64, 48));
+    BasicDesktopFrame current(DesktopSize(64, 48));
+    touch(current, 20, 40);
+
+    const auto rects = diff(previous, current, 16);
+    ASSERT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects[0], DesktopRect::makeXYWH(16, 32, 16, 16));
+}
+
+TEST(FrameDifferTest, AdjacentBlocksAreMerged) {
+    BasicDesktopFrame previous(DesktopSize(64, 64));
+    BasicDesktopFrame current(DesktopSize(64, 64));
+    // A 2x2 block square, and a separate block in the corner
+    touch(current, 0, 0);
+    touch(current, 17, 0);
+    touch(current, 3, 20);
+    touch(current, 31, 31);
+    touch(current, 63, 63);
+
+    const auto rects = diff(previous, current, 16);
+    ASSERT_EQ(rects.size(), 2u);
+    EXPECT_EQ(rects[0], DesktopRect::makeXYWH(0, 0, 32, 32));
+    EXPECT_EQ(rects[1], DesktopRect::makeXYWH(48, 48, 16, 16));
+}
+
+TEST(FrameDifferTest, DifferentSpansAreKeptApart) {
+    BasicDesktopFrame previous(DesktopSize(64, 32));
+    BasicDesktopFrame current(DesktopSize(64, 32));
+    touch(current, 0, 0);
+    touch(current, 0, 16);
+    touch(current, 16, 16);
+
+    const auto rects = diff(previous, current, 16);
+    ASSERT_EQ(rects.size(), 2u);
+    EXPECT_EQ(rects[0], DesktopRect::makeXYWH(0, 0, 16, 16));
+    EXPECT_EQ(rects[1], DesktopRect::makeXYWH(0, 16, 32, 16));
+}
+
+TEST(FrameDifferTest, EdgeBlocksAreClippedToTheFrame) {
+    BasicDesktopFrame previous(DesktopSize(70, 35));
+    BasicDesktopFrame current(DesktopSize(70, 35));
+    touch(current, 69, 34);
+
+    const auto rects = diff(previous, current, 32);
+    ASSERT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects[0], DesktopRect::makeLTRB(64, 32, 70, 35));
+}
+
+TEST(FrameDifferTest, HonoursBothStrides) {
+    const DesktopSize size(8, 4);
+    std::vector<uint8_t> previous(4 * 40, 0);
+    std::vector<uint8_t> current(4 * 48, 0);
+    // Padding past the row end is not compared
+    std::fill(current.begin() + 32, current.begin() + 48, 0xAB);
+    EXPECT_TRUE(findUpdatedRects(previous.data(), 40, current.data(), 48, size, 4).empty());
+
+    current[2 * 48 + 5 * 4] = 1;
+    const auto rects = findUpdatedRects(previous.data(), 40, current.data(), 48, size, 4);
+    ASSERT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects[0], DesktopRect::makeXYWH(4, 0, 4, 4));
+}
+
+}  // namespace desktop_capture
+}  // namespace links
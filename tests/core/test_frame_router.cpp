@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "video/frame_router.h"
+
+namespace links {
+namespace video {
+
+namespace {
+
+struct Tile {
+    std::string name;
+    int frames = 0;
+};
+
+using Router = FrameRouter<Tile>;
+
+std::vector<std::string> routeTo(Router& router, const std::string& participant, VideoViewSource source) {
+    std::vector<std::string> names;
+    router.route(participant, source, [&names](Tile* tile) {
+        ++tile->frames;
+        names.push_back(tile->name);
+    });
+    return names;
+}
+
+}  // namespace
+
+TEST(FrameRouterTest, DeliversToSubscribersOfTheStream) {
+    Router router;
+    Tile main{"main"};
+    Tile sidebar{"sidebar"};
+    Tile other{"other"};
+    router.subscribe(&main, "alice", VideoViewSource::Screen, "main", true);
+    router.subscribe(&sidebar, "alice", VideoViewSource::Camera, "sidebar", true);
+    router.subscribe(&other, "bob", VideoViewSource::Camera, "sidebar", true);
+
+    EXPECT_EQ(routeTo(router, "alice", VideoViewSource::Camera), std::vector<std::string>{"sidebar"});
+    EXPECT_EQ(routeTo(router, "alice", VideoViewSource::Screen), std::vector<std::string>{"main"});
+    EXPECT_TRUE(routeTo(router, "carol", VideoViewSource::Camera).empty());
+    EXPECT_EQ(other.frames, 0);
+
+    const FrameRouterStats& stats = router.stats();
+    EXPECT_EQ(stats.framesRouted, 3);
+    EXPECT_EQ(stats.deliveries, 2);
+    EXPECT_EQ(stats.framesUnrouted, 1);
+}
+
+TEST(FrameRouterTest, AnySourceGetsBothStreams) {
+    Router router;
+    Tile gallery{"gallery"};
+    router.subscribe(&gallery, "alice", VideoViewSource::Any, "gallery", true);
+    routeTo(router, "alice", VideoViewSource::Camera);
+    routeTo(router, "alice", VideoViewSource::Screen);
+    EXPECT_EQ(gallery.frames, 2);
+}
+
+TEST(FrameRouterTest, ResubscribingMovesTheSink) {
+    Router router;
+    Tile main{"main"};
+    router.subscribe(&main, "alice", VideoViewSource::Camera, "main", true);
+    router.subscribe(&main, "bob", VideoViewSource::Camera, "main", true);
+    EXPECT_EQ(router.subscriptionCount(), 1u);
+    EXPECT_TRUE(routeTo(router, "alice", VideoViewSource::Camera).empty());
+    EXPECT_EQ(routeTo(router, "bob", VideoViewSource::Camera).size(), 1u);
+
+    router.unsubscribe(&main);
+    EXPECT_EQ(router.subscriptionCount(), 0u);
+    EXPECT_TRUE(routeTo(router, "bob", VideoViewSource::Camera).empty());
+}
+
+TEST(FrameRouterTest, InactiveSinksKeepTheirSubscription) {
+    Router router;
+    Tile hidden{"hidden"};
+    router.subscribe(&hidden, "alice", VideoViewSource::Camera, "gallery", false);
+    EXPECT_TRUE(routeTo(router, "alice", VideoViewSource::Camera).empty());
+    EXPECT_EQ(router.subscribers("alice", VideoViewSource::Camera), std::vector<Tile*>{&hidden});
+
+    router.subscribe(&hidden, "alice", VideoViewSource::Camera, "gallery", true);
+    EXPECT_EQ(routeTo(router, "alice", VideoViewSource::Camera).size(), 1u);
+}
+
+TEST(FrameRouterTest, CountsDeliveriesPerRole) {
+    Router router;
+    Tile main{"main"};
+    Tile left{"left"};
+    Tile right{"right"};
+    router.subscribe(&main, "alice", VideoViewSource::Camera, "main", true);
+    router.subscribe(&left, "alice", VideoViewSource::Camera, "gallery", true);
+    router.subscribe(&right, "bob", VideoViewSource::Camera, "gallery", true);
+    routeTo(router, "alice", VideoViewSource::Camera);
+    routeTo(router, "bob", VideoViewSource::Camera);
+    // Hiding a tile or removing it keeps its count
+    router.subscribe(&right, "bob", VideoViewSource::Camera, "gallery", false);
+    router.unsubscribe(&main);
+
+    const auto byRole = router.deliveriesByRole();
+    EXPECT_EQ(byRole.at("main"), 1);
+    EXPECT_EQ(byRole.at("gallery"), 2);
+}
+
+TEST(FrameRouterTest, SinksMayUnsubscribeWhileFramesAreDelivered) {
+    Router router;
+    Tile first{"first"};
+    Tile second{"second"};
+    router.subscribe(&first, "alice", VideoViewSource::Camera, "main", true);
+    router.subscribe(&second, "alice", VideoViewSource::Camera, "sidebar", true);
+
+    const size_t delivered = router.route("alice", VideoViewSource::Camera, [&router](Tile* tile) {
+        ++tile->frames;
+        router.unsubscribe(tile);
+    });
+    EXPECT_EQ(delivered, 2u);
+    EXPECT_EQ(first.frames, 1);
+    EXPECT_EQ(second.frames, 1);
+    EXPECT_EQ(router.subscriptionCount(), 0u);
+}
+
+}  // namespace video
+}  // namespace links
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "video/i420_frame.h"
+#include "video/video_kernels.h"
+
+namespace links {
+namespace video {
+
+namespace {
+
+// Packed I420 with constant planes
+std::shared_ptr<std::vector<uint8_t>> flatI420(int width, int height, uint8_t y, uint8_t u, uint8_t v) {
+    auto buffer = std::make_shared<std::vector<uint8_t>>(i420Size(width, height));
+    const I420Planes planes = i420Planes(buffer->data(), width, height);
+    std::fill(planes.y, planes.u, y);
+    std::fill(planes.u, planes.v, u);
+    std::fill(planes.v, buffer->data() + buffer->size(), v);
+    return buffer;
+}
+
+}  // namespace
+
+TEST(I420FrameTest, WrapBorrowsTheBuffer) {
+    auto buffer = flatI420(6, 4, 16, 128, 240);
+    const I420FrameRef frame = I420Frame::wrap(6, 4, buffer->data(), buffer);
+    ASSERT_TRUE(frame);
+    EXPECT_EQ(frame->y(), buffer->data());
+    EXPECT_EQ(frame->u(), buffer->data() + 24);
+    EXPECT_EQ(frame->v(), buffer->data() + 24 + 6);
+    EXPECT_EQ(frame->strideY(), 6);
+    EXPECT_EQ(frame->strideU(), 3);
+    EXPECT_EQ(frame->chromaWidth(), 3);
+    EXPECT_EQ(frame->chromaHeight(), 2);
+
+    // The frame keeps the buffer alive
+    std::weak_ptr<std::vector<uint8_t>> weak = buffer;
+    buffer.reset();
+    EXPECT_FALSE(weak.expired());
+}
+
+TEST(I420FrameTest, WrapRejectsEmptyFrames) {
+    uint8_t byte = 0;
+    EXPECT_FALSE(I420Frame::wrap(0, 4, &byte, nullptr));
+    EXPECT_FALSE(I420Frame::wrap(4, 4, nullptr, nullptr));
+}
+
+TEST(I420FrameTest, HalvedRoundsOddSizesUp) {
+    auto buffer = flatI420(7, 5, 50, 100, 150);
+    const I420FrameRef frame = I420Frame::wrap(7, 5, buffer->data(), buffer);
+    const I420FrameRef half = I420Frame::halved(*frame);
+    ASSERT_TRUE(half);
+    EXPECT_EQ(half->width(), 4);
+    EXPECT_EQ(half->height(), 3);
+    EXPECT_EQ(half->chromaWidth(), 2);
+    EXPECT_EQ(half->chromaHeight(), 2);
+
+    for (int row = 0; row < half->height(); ++row) {
+        for (int x = 0; x < half->width(); ++x) {
+            EXPECT_EQ(half->y()[row * half->strideY() + x], 50);
+        }
+    }
+    for (int row = 0; row < half->chromaHeight(); ++row) {
+        for (int x = 0; x < half->chromaWidth(); ++x) {
+            EXPECT_EQ(half->u()[row * half->strideU() + x], 100);
+            EXPECT_EQ(half->v()[row * half->strideV() + x], 150);
+        }
+    }
+}
+
+}  // namespace video
+}  // namespace links
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "audio/jitter_buffer.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+constexpr int kRate = 48000;
+constexpr size_t kFrame = kRate / 100;  // 10 ms mono
+
+// Drives a JitterBuffer with a 10 ms producer whose frames arrive late by
+// |lateness(i)| ms and a consumer pulling 10 ms on a perfect device clock.
+struct Simulation {
+    JitterBuffer buffer{kRate, 1};
+    std::vector<int16_t> frame = std::vector<int16_t>(kFrame, 1000);
+    std::vector<int16_t> out = std::vector<int16_t>(kFrame);
+    int64_t underrunsAfterWarmup = 0;
+
+    void run(int durationMs, int warmupMs, const std::function<int(int)>& lateness) {
+        int nextFrame = 0;
+        int64_t lastArrival = 0;
+        std::vector<int64_t> arrivals;
+        for (int i = 0; i < durationMs / 10 + 50; ++i) {
+            lastArrival = std::max<int64_t>(lastArrival, i * 10 + lateness(i));
+            arrivals.push_back(lastArrival);
+        }
+        for (int t = 0; t < durationMs; ++t) {
+            while (nextFrame < static_cast<int>(arrivals.size()) && arrivals[nextFrame] <= t) {
+                buffer.push(frame.data(), frame.size(), static_cast<int64_t>(t) * 1000);
+                ++nextFrame;
+            }
+            if (t % 10 == 0) {
+                const int64_t before = buffer.stats().underruns;
+                buffer.pull(out.data(), kFrame);
+                if (t >= warmupMs) {
+                    underrunsAfterWarmup += buffer.stats().underruns - before;
+                }
+            }
+        }
+    }
+};
+
+}  // namespace
+
+TEST(JitterBufferTest, SteadyArrivalsKeepMinimumDelay) {
+    Simulation sim;
+    sim.run(5000, 0, [](int) { return 0; });
+    const auto stats = sim.buffer.stats();
+    EXPECT_EQ(stats.underruns, 0);
+    EXPECT_DOUBLE_EQ(stats.targetDelayMs, JitterBuffer::kMinTargetMs);
+    EXPECT_LE(stats.currentDelayMs, JitterBuffer::kMinTargetMs + 10.0);
+    EXPECT_EQ(sim.out[0], 1000);
+}
+
+TEST(JitterBufferTest, TargetFollowsArrivalJitter) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> late(0, 60);
+    Simulation sim;
+    sim.run(20000, 5000, [&](int) { return late(rng); });
+    const auto stats = sim.buffer.stats();
+
+    EXPECT_GE(stats.targetDelayMs, 55.0);
+    EXPECT_LE(stats.targetDelayMs, 90.0);
+    EXPECT_GT(stats.jitterMs, 5.0);
+    // Once adapted, the 5% tail should only rarely run the buffer dry
+    EXPECT_LE(sim.underrunsAfterWarmup, 20);
+}
+
+TEST(JitterBufferTest, LostAudioDoesNotPinTheTarget) {
+    // 500 ms of audio never arrives (dropped upstream), then the stream is
+    // steady again: every later frame is half a second behind its media time
+    JitterBuffer buffer(kRate, 1);
+    std::vector<int16_t> frame(kFrame, 1000);
+    std::vector<int16_t> out(kFrame);
+    double targetAfterGapMs = 0.0;
+    for (int i = 0; i < 1000; ++i) {
+        if (i < 200 || i >= 250) {
+            buffer.push(frame.data(), frame.size(), static_cast<int64_t>(i) * 10000);
+        }
+        buffer.pull(out.data(), kFrame);
+        if (i == 300) {
+            targetAfterGapMs = buffer.stats().targetDelayMs;
+        }
+    }
+
+    // The step first looks like lateness, and within seconds it no longer does
+    EXPECT_GT(targetAfterGapMs, 100.0);
+    EXPECT_LE(buffer.stats().targetDelayMs, JitterBuffer::kMinTargetMs + 10.0);
+}
+
+TEST(JitterBufferTest, BurstLatencyIsShedByAcceleration) {
+    // The first 300 ms arrive in one burst, then the stream is steady
+    Simulation sim;
+    sim.run(10000, 0, [](int i) { return i < 30 ? 300 - i * 10 : 0; });
+    const auto stats = sim.buffer.stats();
+
+    EXPECT_GT(stats.acceleratedMs, 0.0);
+    EXPECT_LT(stats.currentDelayMs, stats.targetDelayMs + 20.0);
+}
+
+TEST(JitterBufferTest, ConcealmentFadesOutOnUnderrun) {
+    JitterBuffer buffer(kRate, 1);
+    std::vector<int16_t> frame(kFrame, 8000);
+    std::vector<int16_t> out(kFrame);
+    for (int i = 0; i < 3; ++i) {
+        buffer.push(frame.data(), frame.size(), i * 10000);
+    }
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(buffer.pull(out.data(), kFrame), kFrame);
+    }
+
+    // Stream stalls: output decays towards silence instead of dropping to zero
+    buffer.pull(out.data(), kFrame);
+    EXPECT_GT(out[0], 0);
+    EXPECT_LT(out[kFrame - 1], 8000);
+    for (int i = 0; i < 10; ++i) {
+        buffer.pull(out.data(), kFrame);
+    }
+    EXPECT_EQ(out[kFrame - 1], 0);
+
+    const auto stats = buffer.stats();
+    EXPECT_EQ(stats.underruns, 1);
+    EXPECT_GT(stats.concealedMs, 0.0);
+}
+
+TEST(JitterBufferTest, RisingJitterExpandsPlayout) {
+    // Clean for 3 s, then frames start arriving up to 80 ms late
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> late(0, 80);
+    Simulation sim;
+    sim.run(12000, 0, [&](int i) { return i < 300 ? 0 : late(rng); });
+    const auto stats = sim.buffer.stats();
+    EXPECT_GT(stats.targetDelayMs, 60.0);
+    EXPECT_GT(stats.expandedMs, 0.0);
+}
+
+}  // namespace audio
+}  // namespace links
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "video/latest_frame_mailbox.h"
+
+namespace links {
+namespace video {
+
+TEST(LatestFrameMailboxTest, EmptyMailboxHasNothingToTake) {
+    LatestFrameMailbox<int> mailbox;
+    int frame = -1;
+    EXPECT_FALSE(mailbox.hasFrame());
+    EXPECT_FALSE(mailbox.take(&frame));
+    EXPECT_EQ(frame, -1);
+}
+
+TEST(LatestFrameMailboxTest, OnlyTheFirstPostWakesTheConsumer) {
+    LatestFrameMailbox<int> mailbox;
+    EXPECT_TRUE(mailbox.post(1));
+    EXPECT_FALSE(mailbox.post(2));
+    EXPECT_FALSE(mailbox.post(3));
+
+    int frame = 0;
+    ASSERT_TRUE(mailbox.take(&frame));
+    EXPECT_EQ(frame, 3);
+    EXPECT_FALSE(mailbox.take(&frame));
+
+    // Emptied again, so the next post needs a new wake-up
+    EXPECT_TRUE(mailbox.post(4));
+
+    const FrameMailboxStats stats = mailbox.stats();
+    EXPECT_EQ(stats.received, 4);
+    EXPECT_EQ(stats.delivered, 1);
+    EXPECT_EQ(stats.dropped, 2);
+}
+
+TEST(LatestFrameMailboxTest, TakeReleasesTheFrame) {
+    LatestFrameMailbox<std::shared_ptr<int>> mailbox;
+    auto payload = std::make_shared<int>(7);
+    mailbox.post(payload);
+    EXPECT_EQ(payload.use_count(), 2);
+
+    std::shared_ptr<int> frame;
+    ASSERT_TRUE(mailbox.take(&frame));
+    frame.reset();
+    EXPECT_EQ(payload.use_count(), 1);
+}
+
+TEST(LatestFrameMailboxTest, SlowConsumerAccountsForEveryFrame) {
+    constexpr int kFrames = 20000;
+    LatestFrameMailbox<int> mailbox;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&]() {
+        for (int i = 1; i <= kFrames; ++i) {
+            mailbox.post(i);
+        }
+        done.store(true);
+    });
+
+    std::vector<int> seen;
+    int frame = 0;
+    while (!done.load() || mailbox.hasFrame()) {
+        if (mailbox.take(&frame)) {
+            seen.push_back(frame);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    ASSERT_FALSE(seen.empty());
+    for (size_t i = 1; i < seen.size(); ++i) {
+        EXPECT_LT(seen[i - 1], seen[i]);
+    }
+    EXPECT_EQ(seen.back(), kFrames);
+
+    const FrameMailboxStats stats = mailbox.stats();
+    EXPECT_EQ(stats.received, kFrames);
+    EXPECT_EQ(stats.delivered, static_cast<int64_t>(seen.size()));
+    EXPECT_EQ(stats.received, stats.delivered + stats.dropped);
+}
+
+}  // namespace video
+}  // namespace links
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "media/track_executor.h"
+
+namespace links {
+namespace media {
+
+namespace {
+
+void waitUntil(const std::function<bool()>& condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+}  // namespace
+
+TEST(TrackExecutorTest, PoolSizeDoesNotDependOnTrackCount) {
+    TrackExecutor executor(3);
+    for (int i = 0; i < 100; ++i) {
+        executor.addTrack("track-" + std::to_string(i));
+    }
+    EXPECT_EQ(executor.threadCount(), 3u);
+    EXPECT_EQ(executor.trackCount(), 100u);
+
+    TrackExecutor sized;
+    EXPECT_GE(sized.threadCount(), 2u);
+}
+
+TEST(TrackExecutorTest, UnknownTrackIsRejected) {
+    TrackExecutor executor(1);
+    EXPECT_FALSE(executor.post("missing", []() {}));
+}
+
+TEST(TrackExecutorTest, TasksOfOneTrackRunInOrderAndNeverOverlap) {
+    TrackExecutor executor(4, 1000);
+    executor.addTrack("a");
+
+    std::atomic<int> concurrent{0};
+    std::atomic<bool> overlapped{false};
+    std::vector<int> order;
+    std::mutex orderMutex;
+    constexpr int kTasks = 500;
+    for (int i = 0; i < kTasks; ++i) {
+        executor.post("a", [&, i]() {
+            if (concurrent.fetch_add(1) != 0) {
+                overlapped = true;
+            }
+            {
+                std::lock_guard<std::mutex> lock(orderMutex);
+                order.push_back(i);
+            }
+            concurrent.fetch_sub(1);
+        });
+    }
+
+    waitUntil([&]() { return executor.trackStats("a").executed == kTasks; });
+    EXPECT_FALSE(overlapped.load());
+    ASSERT_EQ(order.size(), static_cast<size_t>(kTasks));
+    for (int i = 0; i < kTasks; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(TrackExecutorTest, FullQueueDropsTheOldestTask) {
+    TrackExecutor executor(1, 2);
+    executor.addTrack("a");
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> started{false};
+    executor.post("a", [&]() {
+        started = true;
+        released.wait();
+    });
+    waitUntil([&]() { return started.load(); });
+
+    std::vector<int> ran;
+    std::mutex ranMutex;
+    for (int i = 1; i <= 4; ++i) {
+        executor.post("a", [&, i]() {
+            std::lock_guard<std::mutex> lock(ranMutex);
+            ran.push_back(i);
+        });
+    }
+    release.set_value();
+
+    waitUntil([&]() { return executor.trackStats("a").executed == 3; });
+    EXPECT_EQ(executor.trackStats("a").dropped, 2);
+    std::lock_guard<std::mutex> lock(ranMutex);
+    EXPECT_EQ(ran, (std::vector<int>{3, 4}));
+}
+
+TEST(TrackExecutorTest, TrackQueueDepthOverridesTheDefault) {
+    TrackExecutor executor(1, 2);
+    executor.addTrack("video");
+    executor.addTrack("audio", 16);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> started{false};
+    executor.post("video", [&]() {
+        started = true;
+        released.wait();
+    });
+    waitUntil([&]() { return started.load(); });
+
+    // The only worker is busy, so everything below queues up
+    std::atomic<int> audioRan{0};
+    for (int i = 0; i < 10; ++i) {
+        executor.post("video", []() {});
+        executor.post("audio", [&]() { ++audioRan; });
+    }
+    release.set_value();
+
+    waitUntil([&]() { return audioRan.load() == 10 && executor.trackStats("video").executed == 3; });
+    EXPECT_EQ(audioRan.load(), 10);
+    EXPECT_EQ(executor.trackStats("audio").dropped, 0);
+    EXPECT_EQ(executor.trackStats("video").dropped, 8);
+}
+
+TEST(TrackExecutorTest, BusyTrackDoesNotStarveOthers) {
+    TrackExecutor executor(1, 1000);
+    executor.addTrack("busy");
+    executor.addTrack("quiet");
+
+    // Hold the only worker so the queues fill before anything runs
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    executor.post("busy", [released]() { released.wait(); });
+
+    std::vector<std::string> order;
+    std::mutex orderMutex;
+    const auto record = [&](const std::string& name) {
+        return [&, name]() {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(name);
+        };
+    };
+    for (int i = 0; i < 100; ++i) {
+        executor.post("busy", record("busy"));
+    }
+    executor.post("quiet", record("quiet"));
+    release.set_value();
+
+    waitUntil([&]() { return executor.trackStats("quiet").executed == 1; });
+    std::lock_guard<std::mutex> lock(orderMutex);
+    const auto quiet = std::find(order.begin(), order.end(), "quiet");
+    ASSERT_NE(quiet, order.end());
+    // Round-robin: the quiet track is served right after the busy one's turn
+    EXPECT_LE(quiet - order.begin(), 1);
+}
+
+TEST(TrackExecutorTest, RemoveTrackWaitsForTheRunningTask) {
+    TrackExecutor executor(2);
+    executor.addTrack("a");
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+    executor.post("a", [&]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+    });
+    waitUntil([&]() { return started.load(); });
+
+    executor.removeTrack("a");
+    EXPECT_TRUE(finished.load());
+    EXPECT_EQ(executor.trackCount(), 0u);
+    EXPECT_FALSE(executor.post("a", []() {}));
+}
+
+}  // namespace media
+}  // namespace links
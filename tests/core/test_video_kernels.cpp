@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "video/video_kernels.h"
+
+namespace links {
+namespace video {
+
+namespace {
+
+std::vector<uint8_t> randomBytes(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> bytes(count);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(dist(rng));
+    }
+    return bytes;
+}
+
+// Straightforward per-pixel reference for the packed 4:2:2 layouts
+void referencePacked422(const std::vector<uint8_t>& src, int stride, int width, int height,
+                        bool lumaFirst, std::vector<uint8_t>* out) {
+    out->assign(i420Size(width, height), 0);
+    const I420Planes planes = i420Planes(out->data(), width, height);
+    const int yOffset = lumaFirst ? 0 : 1;
+    const int uOffset = lumaFirst ? 1 : 0;
+    for (int row = 0; row < height; ++row) {
+        for (int x = 0; x < width; ++x) {
+            planes.y[row * planes.strideY + x] = src[row * stride + 2 * x + yOffset];
+        }
+    }
+    for (int row = 0; row < (height + 1) / 2; ++row) {
+        const int top = 2 * row;
+        const int bottom = std::min(top + 1, height - 1);
+        for (int x = 0; x < (width + 1) / 2; ++x) {
+            const int base = 4 * x + uOffset;
+            planes.u[row * planes.strideU + x] = static_cast<uint8_t>(
+                (src[top * stride + base] + src[bottom * stride + base] + 1) >> 1);
+            planes.v[row * planes.strideV + x] = static_cast<uint8_t>(
+                (src[top * stride + base + 2] + src[bottom * stride + base + 2] + 1) >> 1);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(VideoKernelsTest, I420LayoutIsTightlyPacked) {
+    EXPECT_EQ(i420Size(640, 480), 640u * 480u * 3 / 2);
+    EXPECT_EQ(i420Size(5, 3), 5u * 3u + 2u * 3u * 2u);
+
+    std::vector<uint8_t> buffer(i420Size(5, 3));
+    const I420Planes planes = i420Planes(buffer.data(), 5, 3);
+    EXPECT_EQ(planes.strideY, 5);
+    EXPECT_EQ(planes.strideU, 3);
+    EXPECT_EQ(planes.u, buffer.data() + 15);
+    EXPECT_EQ(planes.v, buffer.data() + 21);
+}
+
+TEST(VideoKernelsTest, Nv12AndNv21SplitChromaAtAnySize) {
+    for (int width : {2, 17, 64, 333}) {
+        for (int height : {1, 2, 9, 48}) {
+            const int strideY = width + 7;
+            const int chromaWidth = (width + 1) / 2;
+            const int chromaHeight = (height + 1) / 2;
+            const int strideUV = 2 * chromaWidth + 5;
+            const auto luma = randomBytes(static_cast<size_t>(strideY) * height, width * 31 + height);
+            const auto chroma = randomBytes(static_cast<size_t>(strideUV) * chromaHeight, width + height * 7);
+
+            for (bool swapUV : {false, true}) {
+                std::vector<uint8_t> out(i420Size(width, height));
+                const I420Planes planes = i420Planes(out.data(), width, height);
+                kernels::nv12ToI420(luma.data(), strideY, chroma.data(), strideUV,
+                                    planes, width, height, swapUV);
+
+                bool matches = true;
+                for (int row = 0; row < height; ++row) {
+                    for (int x = 0; x < width; ++x) {
+                        matches = matches && planes.y[row * width + x] == luma[row * strideY + x];
+                    }
+                }
+                for (int row = 0; row < chromaHeight; ++row) {
+                    for (int x = 0; x < chromaWidth; ++x) {
+                        const uint8_t first = chroma[row * strideUV + 2 * x];
+                        const uint8_t second = chroma[row * strideUV + 2 * x + 1];
+                        matches = matches && planes.u[row * chromaWidth + x] == (swapUV ? second : first);
+                        matches = matches && planes.v[row * chromaWidth + x] == (swapUV ? first : second);
+                    }
+                }
+                EXPECT_TRUE(matches) << width << "x" << height << (swapUV ? " NV21" : " NV12");
+            }
+        }
+    }
+}
+
+TEST(VideoKernelsTest, PackedYuvMatchesReference) {
+    for (int width : {2, 16, 38, 640}) {
+        for (int height : {1, 2, 7, 30}) {
+            const int stride = 2 * width + 12;
+            const auto src = randomBytes(static_cast<size_t>(stride) * height, width * 13 + height);
+
+            for (bool lumaFirst : {true, false}) {
+                std::vector<uint8_t> expected;
+                referencePacked422(src, stride, width, height, lumaFirst, &expected);
+
+                std::vector<uint8_t> out(i420Size(width, height), 0);
+                const I420Planes planes = i420Planes(out.data(), width, height);
+                if (lumaFirst) {
+                    kernels::yuy2ToI420(src.data(), stride, planes, width, height);
+                } else {
+                    kernels::uyvyToI420(src.data(), stride, planes, width, height);
+                }
+                EXPECT_EQ(out, expected) << width << "x" << height << (lumaFirst ? " YUYV" : " UYVY");
+            }
+        }
+    }
+}
+
+TEST(VideoKernelsTest, HalvePlaneAveragesEachQuad) {
+    for (int srcWidth : {1, 2, 7, 32, 33, 70, 641}) {
+        for (int srcHeight : {1, 2, 5, 30}) {
+            const int srcStride = srcWidth + 9;
+            const int dstWidth = (srcWidth + 1) / 2;
+            const int dstHeight = (srcHeight + 1) / 2;
+            const int dstStride = dstWidth + 3;
+            const auto src = randomBytes(static_cast<size_t>(srcStride) * srcHeight, srcWidth * 7 + srcHeight);
+
+            std::vector<uint8_t> out(static_cast<size_t>(dstStride) * dstHeight, 0);
+            kernels::halvePlane(src.data(), srcStride, srcWidth, srcHeight, out.data(), dstStride);
+
+            for (int row = 0; row < dstHeight; ++row) {
+                // An odd last row / column pairs with itself
+                const int top = 2 * row * srcStride;
+                const int bottom = std::min(2 * row + 1, srcHeight - 1) * srcStride;
+                for (int x = 0; x < dstWidth; ++x) {
+                    const int left = 2 * x;
+                    const int right = std::min(left + 1, srcWidth - 1);
+                    const int mean = (src[top + left] + src[top + right]
+                                      + src[bottom + left] + src[bottom + right] + 2) >> 2;
+                    EXPECT_NEAR(out[row * dstStride + x], mean, 1)
+                        << srcWidth << "x" << srcHeight << " at " << x << "," << row;
+                }
+            }
+        }
+    }
+}
+
+TEST(VideoKernelsTest, HalvePlaneKeepsFlatPlane) {
+    std::vector<uint8_t> src(64 * 4, 77);
+    std::vector<uint8_t> out(32 * 2, 0);
+    kernels::halvePlane(src.data(), 64, 64, 4, out.data(), 32);
+    EXPECT_EQ(out, std::vector<uint8_t>(32 * 2, 77));
+}
+
+TEST(VideoKernelsTest, ReportsBackend) {
+    const std::string backend = kernels::simdBackend();
+    EXPECT_TRUE(backend == "sse2" || backend == "neon" || backend == "scalar");
+}
+
+}  // namespace video
+}  // namespace links
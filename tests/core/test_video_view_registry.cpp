@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "video/video_view_registry.h"
+
+namespace links {
+namespace video {
+
+namespace {
+
+int tile1;
+int tile2;
+int tile3;
+
+}  // namespace
+
+TEST(VideoViewRegistryTest, UnregisteredParticipantIsNotVisible) {
+    VideoViewRegistry registry;
+    EXPECT_FALSE(registry.demand("alice", VideoViewSource::Camera).visible);
+}
+
+TEST(VideoViewRegistryTest, LargestVisibleViewWins) {
+    VideoViewRegistry registry;
+    registry.updateView(&tile1, "alice", VideoViewSource::Camera, true, 160, 90);
+    registry.updateView(&tile2, "alice", VideoViewSource::Any, true, 1280, 720);
+    registry.updateView(&tile3, "alice", VideoViewSource::Camera, false, 1920, 1080);
+
+    const VideoViewDemand demand = registry.demand("alice", VideoViewSource::Camera);
+    EXPECT_TRUE(demand.visible);
+    EXPECT_EQ(demand.width, 1280);
+    EXPECT_EQ(demand.height, 720);
+
+    registry.removeView(&tile2);
+    EXPECT_EQ(registry.demand("alice", VideoViewSource::Camera).width, 160);
+    EXPECT_EQ(registry.viewCount(), 2u);
+}
+
+TEST(VideoViewRegistryTest, SourcesAreKeptApart) {
+    VideoViewRegistry registry;
+    registry.updateView(&tile1, "alice", VideoViewSource::Screen, true, 640, 360);
+    EXPECT_FALSE(registry.demand("alice", VideoViewSource::Camera).visible);
+    EXPECT_TRUE(registry.demand("alice", VideoViewSource::Screen).visible);
+    EXPECT_FALSE(registry.demand("bob", VideoViewSource::Screen).visible);
+
+    // A view showing whatever is routed to it counts for both streams
+    registry.updateView(&tile2, "alice", VideoViewSource::Any, true, 320, 180);
+    EXPECT_TRUE(registry.demand("alice", VideoViewSource::Camera).visible);
+}
+
+TEST(VideoViewRegistryTest, ZeroSizedViewIsHidden) {
+    VideoViewRegistry registry;
+    registry.updateView(&tile1, "alice", VideoViewSource::Camera, true, 0, 0);
+    EXPECT_FALSE(registry.demand("alice", VideoViewSource::Camera).visible);
+}
+
+TEST(VideoViewRegistryTest, GenerationChangesOnEveryUpdate) {
+    VideoViewRegistry registry;
+    const uint64_t initial = registry.generation();
+    registry.updateView(&tile1, "alice", VideoViewSource::Camera, true, 160, 90);
+    const uint64_t updated = registry.generation();
+    EXPECT_NE(updated, initial);
+
+    registry.removeView(&tile2);  // unknown view
+    EXPECT_EQ(registry.generation(), updated);
+    registry.removeView(&tile1);
+    EXPECT_NE(registry.generation(), updated);
+}
+
+TEST(VideoViewRegistryTest, DownscaleKeepsFrameAtLeastAsLargeAsTheView) {
+    VideoViewDemand demand;
+    demand.visible = true;
+
+    demand.width = 1280;
+    demand.height = 720;
+    EXPECT_EQ(downscaleSteps(1920, 1080, demand), 0);
+
+    demand.width = 320;
+    demand.height = 180;
+    EXPECT_EQ(downscaleSteps(1280, 720, demand), 2);
+    EXPECT_EQ(downscaleSteps(1920, 1080, demand), 2);
+
+    // Height bound: a wide tile still needs the full height
+    demand.width = 100;
+    demand.height = 720;
+    EXPECT_EQ(downscaleSteps(1280, 720, demand), 0);
+
+    demand.width = 8;
+    demand.height = 8;
+    EXPECT_EQ(downscaleSteps(3840, 2160, demand), 3);
+
+    demand.visible = false;
+    EXPECT_EQ(downscaleSteps(3840, 2160, demand), 0);
+}
+
+}  // namespace video
+}  // namespace links
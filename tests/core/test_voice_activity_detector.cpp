@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "audio/audio_kernels.h"
+#include "audio/voice_activity_detector.h"
+
+namespace links {
+namespace audio {
+
+namespace {
+
+constexpr int kRate = 48000;
+constexpr size_t kFrame = kRate / 100;  // 10 ms mono
+constexpr double kPi = 3.14159265358979323846;
+
+std::vector<int16_t> tone(double amplitude, size_t offset) {
+    std::vector<int16_t> frame(kFrame);
+    for (size_t i = 0; i < kFrame; ++i) {
+        frame[i] = static_cast<int16_t>(amplitude * std::sin(2.0 * kPi * 300.0 * (offset + i) / kRate));
+    }
+    return frame;
+}
+
+std::vector<int16_t> noise(std::mt19937& rng, int amplitude) {
+    std::uniform_int_distribution<int> dist(-amplitude, amplitude);
+    std::vector<int16_t> frame(kFrame);
+    for (auto& sample : frame) {
+        sample = static_cast<int16_t>(dist(rng));
+    }
+    return frame;
+}
+
+// Feeds |frames| 10 ms frames and returns how many state changes were reported
+int feed(VoiceActivityDetector& vad, int frames, double amplitude, size_t* offset) {
+    int transitions = 0;
+    for (int i = 0; i < frames; ++i) {
+        const auto frame = tone(amplitude, *offset);
+        *offset += kFrame;
+        transitions += vad.process(frame.data(), kFrame, kRate, 1) ? 1 : 0;
+    }
+    return transitions;
+}
+
+}  // namespace
+
+TEST(AudioKernelsTest, SumSquaresAndPeakMatchesScalar) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist(INT16_MIN, INT16_MAX);
+    for (size_t count : {0u, 1u, 7u, 8u, 480u, 963u}) {
+        std::vector<int16_t> in(count);
+        for (auto& sample : in) {
+            sample = static_cast<int16_t>(dist(rng));
+        }
+        if (count > 3) {
+            in[3] = INT16_MIN;
+        }
+        uint64_t expectedSum = 0;
+        int32_t expectedPeak = 0;
+        for (int16_t sample : in) {
+            expectedSum += static_cast<uint64_t>(static_cast<int64_t>(sample) * sample);
+            expectedPeak = std::max(expectedPeak, std::abs(static_cast<int32_t>(sample)));
+        }
+
+        uint64_t sum = 1;
+        int32_t peak = -1;
+        kernels::sumSquaresAndPeak(in.data(), in.size(), &sum, &peak);
+        EXPECT_EQ(sum, expectedSum) << "count " << count;
+        EXPECT_EQ(peak, expectedPeak) << "count " << count;
+    }
+}
+
+TEST(VoiceActivityDetectorTest, AttackAndReleaseHysteresis) {
+    VoiceActivityDetector vad;
+    size_t offset = 0;
+
+    EXPECT_EQ(feed(vad, 100, 0.0, &offset), 0);
+    EXPECT_FALSE(vad.isSpeaking());
+
+    // Speech at about -20 dBFS needs the full attack time
+    EXPECT_EQ(feed(vad, VoiceActivityDetector::kAttackMs / 10 - 1, 4000.0, &offset), 0);
+    EXPECT_FALSE(vad.isSpeaking());
+    EXPECT_EQ(feed(vad, 1, 4000.0, &offset), 1);
+    EXPECT_TRUE(vad.isSpeaking());
+    EXPECT_GT(vad.level(), 0.5f);
+
+    // A 200 ms word gap does not end the utterance
+    EXPECT_EQ(feed(vad, 20, 0.0, &offset), 0);
+    EXPECT_EQ(feed(vad, 50, 4000.0, &offset), 0);
+    EXPECT_TRUE(vad.isSpeaking());
+
+    // Silence longer than the release time does, exactly once
+    EXPECT_EQ(feed(vad, VoiceActivityDetector::kReleaseMs / 10 + 10, 0.0, &offset), 1);
+    EXPECT_FALSE(vad.isSpeaking());
+}
+
+TEST(VoiceActivityDetectorTest, SingleClickIsIgnored) {
+    VoiceActivityDetector vad;
+    size_t offset = 0;
+    feed(vad, 50, 0.0, &offset);
+    EXPECT_EQ(feed(vad, 1, 20000.0, &offset), 0);
+    EXPECT_EQ(feed(vad, 100, 0.0, &offset), 0);
+    EXPECT_FALSE(vad.isSpeaking());
+}
+
+TEST(VoiceActivityDetectorTest, SteadyNoiseRaisesTheFloor) {
+    VoiceActivityDetector vad;
+    std::mt19937 rng(3);
+    int transitions = 0;
+
+    // Constant fan noise at about -40 dBFS: may trigger briefly while the
+    // floor adapts but must settle to silent
+    for (int i = 0; i < 3000; ++i) {
+        const auto frame = noise(rng, 560);
+        transitions += vad.process(frame.data(), kFrame, kRate, 1) ? 1 : 0;
+    }
+    EXPECT_FALSE(vad.isSpeaking());
+    EXPECT_LE(transitions, 2);
+    EXPECT_GT(vad.noiseFloorDb(), -50.0f);
+
+    // Speech well above the noise is still detected
+    size_t offset = 0;
+    EXPECT_EQ(feed(vad, 10, 8000.0, &offset), 1);
+}
+
+TEST(VoiceActivityDetectorTest, ResetReportsPreviousState) {
+    VoiceActivityDetector vad;
+    size_t offset = 0;
+    feed(vad, 10, 4000.0, &offset);
+    ASSERT_TRUE(vad.isSpeaking());
+    EXPECT_TRUE(vad.reset());
+    EXPECT_FALSE(vad.isSpeaking());
+    EXPECT_FLOAT_EQ(vad.level(), 0.0f);
+    EXPECT_FALSE(vad.reset());
+}
+
+}  // namespace audio
+}  // namespace links
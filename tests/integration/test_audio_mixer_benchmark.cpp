@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/audio/audio_kernels.h"
+#include "core/audio/audio_mixer.h"
+
+namespace {
+
+bool benchmarkEnabled()
+{
+    const char* value = std::getenv("LINKS_RUN_AUDIO_BENCHMARK");
+    return value && std::string(value) == "1";
+}
+
+}  // namespace
+
+// Mixes N remote tracks (48 kHz mono, as delivered by LiveKit) into one
+// 48 kHz stereo output and reports the cost per 10 ms of audio.
+TEST(AudioMixerBenchmarkTest, ScalesWithTrackCount)
+{
+    if (!benchmarkEnabled()) {
+        GTEST_SKIP() << "Set LINKS_RUN_AUDIO_BENCHMARK=1 to run audio mixer benchmark.";
+    }
+
+    constexpr int kRate = 48000;
+    constexpr size_t kFrame = kRate / 100;
+    constexpr int kIterations = 2000;
+    const int trackCounts[] = {1, 4, 8, 16, 32, 64, 100};
+
+    std::vector<int16_t> input(kFrame);
+    for (size_t i = 0; i < kFrame; ++i) {
+        input[i] = static_cast<int16_t>(8000 * std::sin(0.05 * static_cast<double>(i)));
+    }
+    std::vector<int16_t> output(kFrame * 2);
+
+    for (const int trackCount : trackCounts) {
+        links::audio::AudioMixer mixer(kRate, 2);
+        std::vector<std::shared_ptr<links::audio::AudioMixer::Track>> tracks;
+        for (int t = 0; t < trackCount; ++t) {
+            tracks.push_back(mixer.addTrack("track-" + std::to_string(t)));
+            tracks.back()->setGain(0.8f);
+            // Prime past the mixer's start threshold
+            for (int f = 0; f < 3; ++f) {
+                tracks.back()->push(input.data(), kFrame, kRate, 1);
+            }
+        }
+
+        std::chrono::nanoseconds pushTime{0};
+        std::chrono::nanoseconds mixTime{0};
+        for (int i = 0; i < kIterations; ++i) {
+            const auto pushBegin = std::chrono::steady_clock::now();
+            for (auto& track : tracks) {
+                track->push(input.data(), kFrame, kRate, 1);
+            }
+            const auto mixBegin = std::chrono::steady_clock::now();
+            mixer.mix(output.data(), kFrame);
+            const auto mixEnd = std::chrono::steady_clock::now();
+            pushTime += mixBegin - pushBegin;
+            mixTime += mixEnd - mixBegin;
+        }
+
+        int64_t underruns = 0;
+        for (const auto& track : tracks) {
+            underruns += track->underruns();
+        }
+        EXPECT_EQ(underruns, 0);
+
+        const double mixUs = std::chrono::duration<double, std::micro>(mixTime).count() / kIterations;
+        const double pushUs = std::chrono::duration<double, std::micro>(pushTime).count() / kIterations;
+        std::cout << "audio mixer benchmark: simd=" << links::audio::kernels::simdBackend()
+                  << ", tracks=" << trackCount
+                  << ", mix_us_per_10ms=" << mixUs
+                  << ", push_us_per_10ms=" << pushUs
+                  << ", realtime_factor=" << (10000.0 / (mixUs + pushUs)) << std::endl;
+    }
+}
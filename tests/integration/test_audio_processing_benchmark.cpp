@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/audio_processing_module.h"
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+bool benchmarkEnabled()
+{
+    const char* value = std::getenv("LINKS_RUN_AUDIO_BENCHMARK");
+    return value && std::string(value) == "1";
+}
+
+// Seconds of audio per configuration (LINKS_APM_BENCHMARK_SECONDS, default 20)
+int benchmarkSeconds()
+{
+    const char* value = std::getenv("LINKS_APM_BENCHMARK_SECONDS");
+    const int seconds = value ? std::atoi(value) : 0;
+    return seconds > 0 ? seconds : 20;
+}
+
+// Speech-like test signal: a gliding 100-220 Hz harmonic series shaped by a
+// ~4 Hz syllable envelope with pauses, over a constant noise bed. Both
+// channels carry the same talker with slightly different noise.
+std::vector<int16_t> makeSignal(int sampleRate, int channels, int seconds)
+{
+    std::mt19937 rng(1234);
+    std::normal_distribution<double> noise(0.0, 300.0);
+
+    const size_t frames = static_cast<size_t>(sampleRate) * seconds;
+    std::vector<int16_t> signal(frames * channels);
+    double phase = 0.0;
+    for (size_t n = 0; n < frames; ++n) {
+        const double t = static_cast<double>(n) / sampleRate;
+        const double pitch = 160.0 + 60.0 * std::sin(2.0 * kPi * 0.7 * t);
+        phase += 2.0 * kPi * pitch / sampleRate;
+
+        double voiced = 0.0;
+        for (int harmonic = 1; harmonic <= 12 && harmonic * pitch < sampleRate / 2; ++harmonic) {
+            voiced += std::sin(harmonic * phase) / harmonic;
+        }
+
+        // Talk for 3 s, pause for 1 s
+        const double syllable = std::max(0.0, std::sin(2.0 * kPi * 4.0 * t));
+        const double talking = std::fmod(t, 4.0) < 3.0 ? 1.0 : 0.0;
+        const double speech = 6000.0 * voiced * syllable * talking;
+
+        for (int c = 0; c < channels; ++c) {
+            const double value = speech + noise(rng);
+            signal[n * channels + c] = static_cast<int16_t>(std::clamp(value, -32768.0, 32767.0));
+        }
+    }
+    return signal;
+}
+
+struct Result {
+    int sampleRate;
+    int channels;
+    bool aec;
+    bool ns;
+    bool agc;
+    double meanUs;
+    double p99Us;
+    double maxUs;
+};
+
+std::string toJson(const Result& r)
+{
+    std::ostringstream out;
+    out << "{\"sample_rate\":" << r.sampleRate
+        << ",\"channels\":" << r.channels
+        << ",\"aec\":" << (r.aec ? "true" : "false")
+        << ",\"ns\":" << (r.ns ? "true" : "false")
+        << ",\"agc\":" << (r.agc ? "true" : "false")
+        << ",\"mean_us_per_10ms\":" << r.meanUs
+        << ",\"p99_us_per_10ms\":" << r.p99Us
+        << ",\"max_us_per_10ms\":" << r.maxUs
+        << ",\"realtime_factor\":" << (10000.0 / r.meanUs) << "}";
+    return out.str();
+}
+
+}  // namespace
+
+// Runs processFrame over a long synthetic speech + noise signal for every
+// rate / channel layout / AEC-NS-AGC combination and reports the cost per
+// 10 ms frame. Results are printed one per line and, when
+// LINKS_APM_BENCHMARK_JSON names a file, written there as a JSON array.
+TEST(AudioProcessingBenchmarkTest, ConfigurationMatrix)
+{
+    if (!benchmarkEnabled()) {
+        GTEST_SKIP() << "Set LINKS_RUN_AUDIO_BENCHMARK=1 to run audio processing benchmark.";
+    }
+
+    const int seconds = benchmarkSeconds();
+    const int sampleRates[] = {16000, 32000, 48000};
+    const int channelCounts[] = {1, 2};
+    std::vector<Result> results;
+
+    for (const int sampleRate : sampleRates) {
+        for (const int channels : channelCounts) {
+            const std::vector<int16_t> signal = makeSignal(sampleRate, channels, seconds);
+            const size_t frameSamples = static_cast<size_t>(sampleRate / 100) * channels;
+            const size_t frameCount = signal.size() / frameSamples;
+
+            for (int mask = 0; mask < 8; ++mask) {
+                const bool aec = (mask & 1) != 0;
+                const bool ns = (mask & 2) != 0;
+                const bool agc = (mask & 4) != 0;
+
+                AudioProcessingModule apm;
+                apm.setEchoCancellationEnabled(aec);
+                apm.setNoiseSuppressionEnabled(ns);
+                apm.setAutoGainControlEnabled(agc);
+                ASSERT_TRUE(apm.initialize());
+
+                std::vector<int16_t> frame(frameSamples);
+                std::vector<double> durations;
+                durations.reserve(frameCount);
+                for (size_t f = 0; f < frameCount; ++f) {
+                    std::copy_n(signal.begin() + static_cast<std::ptrdiff_t>(f * frameSamples),
+                                frameSamples, frame.begin());
+                    const auto begin = std::chrono::steady_clock::now();
+                    const bool ok = apm.processFrame(frame.data(), sampleRate / 100, sampleRate, channels);
+                    const auto end = std::chrono::steady_clock::now();
+                    ASSERT_TRUE(ok);
+                    durations.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+                }
+
+                Result result{sampleRate, channels, aec, ns, agc, 0.0, 0.0, 0.0};
+                for (const double us : durations) {
+                    result.meanUs += us;
+                }
+                result.meanUs /= static_cast<double>(durations.size());
+                std::sort(durations.begin(), durations.end());
+                result.p99Us = durations[std::min(durations.size() - 1, durations.size() * 99 / 100)];
+                result.maxUs = durations.back();
+                results.push_back(result);
+
+                std::cout << "apm benchmark: rate=" << sampleRate
+                          << ", channels=" << channels
+                          << ", aec=" << aec << ", ns=" << ns << ", agc=" << agc
+                          << ", mean_us_per_10ms=" << result.meanUs
+                          << ", p99_us_per_10ms=" << result.p99Us
+                          << ", max_us_per_10ms=" << result.maxUs
+                          << ", realtime_factor=" << (10000.0 / result.meanUs) << std::endl;
+            }
+        }
+    }
+
+    if (const char* path = std::getenv("LINKS_APM_BENCHMARK_JSON")) {
+        std::ofstream file(path);
+        ASSERT_TRUE(file.is_open()) << "Cannot write " << path;
+        file << "[\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            file << "  " << toJson(results[i]) << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        file << "]\n";
+        std::cout << "apm benchmark: wrote " << results.size() << " results to " << path << std::endl;
+    }
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "core/audio/audio_kernels.h"
+#include "core/audio/capture_converter.h"
+
+namespace {
+
+bool benchmarkEnabled()
+{
+    const char* value = std::getenv("LINKS_RUN_AUDIO_BENCHMARK");
+    return value && std::string(value) == "1";
+}
+
+}  // namespace
+
+// Converts 10 ms device chunks in common native formats to 48 kHz mono int16
+// and reports the cost per 10 ms of audio.
+TEST(AudioResamplerBenchmarkTest, CaptureConversionThroughput)
+{
+    if (!benchmarkEnabled()) {
+        GTEST_SKIP() << "Set LINKS_RUN_AUDIO_BENCHMARK=1 to run audio resampler benchmark.";
+    }
+
+    using links::audio::SampleFormat;
+    const struct {
+        int rate;
+        int channels;
+        SampleFormat format;
+        const char* name;
+    } formats[] = {
+        {48000, 1, SampleFormat::Int16, "int16"},
+        {48000, 2, SampleFormat::Float, "float"},
+        {44100, 2, SampleFormat::Float, "float"},
+        {44100, 1, SampleFormat::Int16, "int16"},
+        {16000, 1, SampleFormat::Int16, "int16"},
+        {96000, 2, SampleFormat::Int32, "int32"},
+    };
+    constexpr int kIterations = 5000;
+
+    for (const auto& f : formats) {
+        const size_t frames = static_cast<size_t>(f.rate / 100);
+        links::audio::CaptureConverter converter;
+        ASSERT_TRUE(converter.configure(f.rate, f.channels, f.format, frames));
+
+        std::vector<char> input(frames * converter.bytesPerFrame());
+        for (size_t i = 0; i < frames * static_cast<size_t>(f.channels); ++i) {
+            const double value = std::sin(0.01 * static_cast<double>(i));
+            if (f.format == SampleFormat::Float) {
+                reinterpret_cast<float*>(input.data())[i] = static_cast<float>(0.5 * value);
+            } else if (f.format == SampleFormat::Int32) {
+                reinterpret_cast<int32_t*>(input.data())[i] = static_cast<int32_t>(1e9 * value);
+            } else {
+                reinterpret_cast<int16_t*>(input.data())[i] = static_cast<int16_t>(16000 * value);
+            }
+        }
+        std::vector<int16_t> output(converter.maxOutputFrames(frames));
+
+        size_t produced = 0;
+        const auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; ++i) {
+            produced += converter.process(input.data(), frames, output.data());
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+
+        EXPECT_NEAR(static_cast<double>(produced) / kIterations, 480.0, 1.0);
+        const double us = std::chrono::duration<double, std::micro>(elapsed).count() / kIterations;
+        std::cout << "audio resampler benchmark: simd=" << links::audio::kernels::simdBackend()
+                  << ", input=" << f.rate << "/" << f.channels << "/" << f.name
+                  << ", us_per_10ms=" << us
+                  << ", realtime_factor=" << (10000.0 / us) << std::endl;
+    }
+}
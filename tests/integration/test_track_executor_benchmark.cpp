@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/media/track_executor.h"
+
+namespace {
+
+bool benchmarkEnabled()
+{
+    const char* value = std::getenv("LINKS_RUN_MEDIA_BENCHMARK");
+    return value && std::string(value) == "1";
+}
+
+// Threads in this process, or -1 where /proc is not available
+int processThreadCount()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("Threads:", 0) == 0) {
+            return std::atoi(line.c_str() + 8);
+        }
+    }
+    return -1;
+}
+
+constexpr int kFps = 30;
+constexpr int kWidth = 320;
+constexpr int kHeight = 180;
+constexpr auto kRunTime = std::chrono::milliseconds(2000);
+
+// Stand-in for per-frame conversion: touches every byte of an RGBA frame
+struct SyntheticTrack {
+    std::vector<uint8_t> frame = std::vector<uint8_t>(static_cast<size_t>(kWidth) * kHeight * 4, 0x5a);
+    std::atomic<int64_t> processed{0};
+    uint64_t checksum = 0;
+
+    void process()
+    {
+        uint64_t sum = 0;
+        for (uint8_t byte : frame) {
+            sum += byte;
+        }
+        checksum += sum;
+        processed.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+struct LoadResult {
+    int threads = 0;
+    int poolThreads = 0;
+    double cpuPercent = 0.0;
+    int64_t processed = 0;
+    int64_t dropped = 0;
+};
+
+// Baseline: one thread per track, as MediaPipeline used to do
+LoadResult runThreadPerTrack(int trackCount)
+{
+    std::vector<std::unique_ptr<SyntheticTrack>> tracks;
+    for (int i = 0; i < trackCount; ++i) {
+        tracks.push_back(std::make_unique<SyntheticTrack>());
+    }
+
+    std::atomic<bool> stop{false};
+    const std::clock_t cpuBegin = std::clock();
+    const auto wallBegin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (auto& track : tracks) {
+        threads.emplace_back([&stop, track = track.get()]() {
+            auto next = std::chrono::steady_clock::now();
+            while (!stop.load()) {
+                next += std::chrono::microseconds(1000000 / kFps);
+                std::this_thread::sleep_until(next);
+                track->process();
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(kRunTime / 2);
+    LoadResult result;
+    result.threads = processThreadCount();
+    std::this_thread::sleep_for(kRunTime / 2);
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallBegin).count();
+    result.cpuPercent = 100.0 * static_cast<double>(std::clock() - cpuBegin) / CLOCKS_PER_SEC / wallSeconds;
+    for (const auto& track : tracks) {
+        result.processed += track->processed.load();
+    }
+    return result;
+}
+
+// The production shape: each track keeps a reader blocked in the SDK's
+// read() (here a sleep until the next frame) that hands every frame to the
+// shared executor, where the per-frame work runs
+LoadResult runSharedExecutor(int trackCount)
+{
+    std::vector<std::unique_ptr<SyntheticTrack>> tracks;
+    links::media::TrackExecutor executor;
+    for (int i = 0; i < trackCount; ++i) {
+        tracks.push_back(std::make_unique<SyntheticTrack>());
+        executor.addTrack("track-" + std::to_string(i));
+    }
+
+    std::atomic<bool> stop{false};
+    const std::clock_t cpuBegin = std::clock();
+    const auto wallBegin = std::chrono::steady_clock::now();
+    std::vector<std::thread> readers;
+    for (int i = 0; i < trackCount; ++i) {
+        readers.emplace_back([&stop, &executor, key = "track-" + std::to_string(i), track = tracks[i].get()]() {
+            auto next = std::chrono::steady_clock::now();
+            while (!stop.load()) {
+                next += std::chrono::microseconds(1000000 / kFps);
+                std::this_thread::sleep_until(next);
+                executor.post(key, [track]() { track->process(); });
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(kRunTime / 2);
+    LoadResult result;
+    result.threads = processThreadCount();
+    result.poolThreads = static_cast<int>(executor.threadCount());
+    std::this_thread::sleep_for(kRunTime / 2);
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallBegin).count();
+    result.cpuPercent = 100.0 * static_cast<double>(std::clock() - cpuBegin) / CLOCKS_PER_SEC / wallSeconds;
+    for (int i = 0; i < trackCount; ++i) {
+        result.processed += tracks[i]->processed.load();
+        result.dropped += executor.trackStats("track-" + std::to_string(i)).dropped;
+    }
+    return result;
+}
+
+}  // namespace
+
+// Synthetic 30 fps video tracks at 10/50/100 per room, processed either by
+// a thread per track or by per-track readers feeding the shared
+// TrackExecutor. Reports the process thread count and CPU use of each. The
+// readers remain, so the pool adds its workers to the thread count rather
+// than replacing the per-track threads.
+TEST(TrackExecutorBenchmarkTest, ThreadCountAndCpuByTrackCount)
+{
+    if (!benchmarkEnabled()) {
+        GTEST_SKIP() << "Set LINKS_RUN_MEDIA_BENCHMARK=1 to run track executor benchmark.";
+    }
+
+    const int trackCounts[] = {10, 50, 100};
+    for (const int trackCount : trackCounts) {
+        const LoadResult perTrack = runThreadPerTrack(trackCount);
+        const LoadResult shared = runSharedExecutor(trackCount);
+
+        // Both keep up with the frame rate; the pool costs only its workers
+        // on top of the readers
+        const int64_t expected = static_cast<int64_t>(trackCount) * kFps * 9 / 10;
+        EXPECT_GE(perTrack.processed, expected);
+        EXPECT_GE(shared.processed + shared.dropped, expected);
+        if (perTrack.threads > 0 && shared.threads > 0) {
+            EXPECT_LE(shared.threads, perTrack.threads + shared.poolThreads);
+        }
+
+        std::cout << "track executor benchmark: tracks=" << trackCount
+                  << ", per_track_threads=" << perTrack.threads
+                  << ", per_track_cpu_percent=" << perTrack.cpuPercent
+                  << ", pooled_threads=" << shared.threads
+                  << ", pool_workers=" << shared.poolThreads
+                  << ", pooled_cpu_percent=" << shared.cpuPercent
+                  << ", pool_frames=" << shared.processed
+                  << ", pool_dropped=" << shared.dropped << std::endl;
+    }
+}
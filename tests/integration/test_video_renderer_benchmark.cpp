@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include <QImage>
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QVideoFrame>
+#include <QVideoSink>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "core/video/i420_frame.h"
+#include "core/video/video_kernels.h"
+#include "ui/backend/VideoRenderer.h"
+
+// Every operator new in the process, Qt's included. Pixel buffers that Qt
+// mallocs directly are accounted for separately below.
+namespace {
+std::atomic<int64_t> heapAllocations{0};
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace {
+
+bool benchmarkEnabled()
+{
+    const char* value = std::getenv("LINKS_RUN_MEDIA_BENCHMARK");
+    return value && std::string(value) == "1";
+}
+
+constexpr int kFrames = 300;
+constexpr int kWidth = 1280;
+constexpr int kHeight = 720;
+
+struct PathCost {
+    double heapAllocations = 0.0;  // operator new calls per displayed frame
+    double pixelBuffers = 0.0;     // whole-frame buffers allocated per frame
+    double bytesCopied = 0.0;      // pixel bytes written per frame
+};
+
+void report(const char* path, const PathCost& cost)
+{
+    std::cout << "video renderer benchmark: path=" << path
+              << ", heap_allocations_per_frame=" << cost.heapAllocations
+              << ", pixel_buffers_per_frame=" << cost.pixelBuffers
+              << ", bytes_copied_per_frame=" << cost.bytesCopied << std::endl;
+}
+
+// The renderer before pooling: mirror by copying, then wrap a new frame
+PathCost runLegacyMirrored(QVideoSink* sink, const QImage& image)
+{
+    PathCost cost;
+    const int64_t before = heapAllocations.load();
+    for (int i = 0; i < kFrames; ++i) {
+        const QImage mirrored = image.mirrored(true, false);
+        cost.pixelBuffers += 1;
+        cost.bytesCopied += static_cast<double>(mirrored.sizeInBytes());
+        sink->setVideoFrame(QVideoFrame(mirrored));
+    }
+    cost.heapAllocations = static_cast<double>(heapAllocations.load() - before) / kFrames;
+    cost.pixelBuffers /= kFrames;
+    cost.bytesCopied /= kFrames;
+    return cost;
+}
+
+template <typename Present>
+PathCost runRenderer(VideoRenderer* renderer, Present present)
+{
+    const VideoRenderer::RenderStats start = renderer->renderStatistics();
+    const int64_t before = heapAllocations.load();
+    for (int i = 0; i < kFrames; ++i) {
+        present();
+    }
+    const VideoRenderer::RenderStats end = renderer->renderStatistics();
+
+    PathCost cost;
+    cost.heapAllocations = static_cast<double>(heapAllocations.load() - before) / kFrames;
+    // Wrapped frames share the image's pixels; pooled frames own theirs
+    cost.pixelBuffers = 0.0;
+    cost.bytesCopied = static_cast<double>(end.bytesCopied - start.bytesCopied) / kFrames;
+    EXPECT_EQ(end.framesPresented - start.framesPresented, kFrames);
+    return cost;
+}
+
+}  // namespace
+
+// Allocations and bytes copied per displayed 720p frame: the old
+// copy-to-mirror path against VideoRenderer's flag-based mirroring, its
+// conversion pool and its planar path
+TEST(VideoRendererBenchmarkTest, AllocationsAndBytesCopiedPerFrame)
+{
+    if (!benchmarkEnabled()) {
+        GTEST_SKIP() << "Set LINKS_RUN_MEDIA_BENCHMARK=1 to run video renderer benchmark.";
+    }
+
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    int argc = 0;
+    QGuiApplication app(argc, nullptr);
+
+    QImage rgba(kWidth, kHeight, QImage::Format_RGBA8888);
+    rgba.fill(Qt::darkCyan);
+    const QImage rgb888 = rgba.convertToFormat(QImage::Format_RGB888);
+
+    auto i420Buffer = std::make_shared<std::vector<uint8_t>>(links::video::i420Size(kWidth, kHeight), 0x80);
+    const links::video::I420FrameRef i420 =
+        links::video::I420Frame::wrap(kWidth, kHeight, i420Buffer->data(), i420Buffer);
+
+    QVideoSink legacySink;
+    const PathCost legacy = runLegacyMirrored(&legacySink, rgba);
+
+    QVideoSink sink;
+    VideoRenderer renderer;
+    renderer.setVideoSink(&sink);
+    renderer.setMirrored(true);
+
+    const PathCost mirrored = runRenderer(&renderer, [&]() { renderer.updateImageFrame(rgba); });
+    const PathCost converted = runRenderer(&renderer, [&]() { renderer.updateImageFrame(rgb888); });
+    const PathCost planar = runRenderer(&renderer, [&]() { renderer.updateYuvFrame(*i420); });
+
+    report("legacy_mirrored_rgba", legacy);
+    report("mirrored_rgba", mirrored);
+    report("pooled_rgb888_conversion", converted);
+    report("pooled_i420", planar);
+
+    // Mirroring no longer copies the frame
+    EXPECT_EQ(mirrored.bytesCopied, 0.0);
+    EXPECT_GT(legacy.bytesCopied, 0.0);
+    // Pooled frames are only written to, never reallocated per frame
+    EXPECT_EQ(planar.bytesCopied, static_cast<double>(links::video::i420Size(kWidth, kHeight)));
+    EXPECT_LT(planar.bytesCopied, legacy.bytesCopied);
+}
+
+// Time per 720p frame of the planar path against the RGBA conversion it
+// replaces (what the renderer used to do for every YUV frame)
+TEST(VideoRendererBenchmarkTest, PlanarUploadAgainstRgbaConversion)
+{
+    if (!benchmarkEnabled()) {
+        GTEST_SKIP() << "Set LINKS_RUN_MEDIA_BENCHMARK=1 to run video renderer benchmark.";
+    }
+
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    int argc = 0;
+    QGuiApplication app(argc, nullptr);
+
+    auto i420Buffer = std::make_shared<std::vector<uint8_t>>(links::video::i420Size(kWidth, kHeight), 0x80);
+    const links::video::I420FrameRef i420 =
+        links::video::I420Frame::wrap(kWidth, kHeight, i420Buffer->data(), i420Buffer);
+
+    QVideoSink sink;
+    VideoRenderer renderer;
+    renderer.setVideoSink(&sink);
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < kFrames; ++i) {
+        renderer.updateYuvFrame(*i420);
+    }
+    const double uploadUs = timer.nsecsElapsed() / 1000.0 / kFrames;
+
+    const QVideoFrame presented = sink.videoFrame();
+    ASSERT_TRUE(presented.isValid());
+    timer.restart();
+    for (int i = 0; i < kFrames; ++i) {
+        const QImage converted = presented.toImage();
+        ASSERT_FALSE(converted.isNull());
+    }
+    const double conversionUs = timer.nsecsElapsed() / 1000.0 / kFrames;
+
+    std::cout << "video renderer benchmark: planar_upload_us_per_frame=" << uploadUs
+              << ", rgba_conversion_us_per_frame=" << conversionUs << std::endl;
+}
+
+// A 60 fps screen share and a 30 fps camera in a window refreshing at
+// 30 Hz: each renderer reaches its sink once per window frame, and the
+// screen share's extra frames are counted as dropped
+TEST(VideoRendererBenchmarkTest, CoalescesFramesToTheWindowFrame)
+{
+    if (!benchmarkEnabled()) {
+        GTEST_SKIP() << "Set LINKS_RUN_MEDIA_BENCHMARK=1 to run video renderer benchmark.";
+    }
+
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    int argc = 0;
+    QGuiApplication app(argc, nullptr);
+
+    // Stands in for VideoOutput, which owns the sink it exposes
+    QQuickWindow window;
+    QQuickItem screenItem(window.contentItem());
+    QQuickItem cameraItem(window.contentItem());
+    auto* screenSink = new QVideoSink(&screenItem);
+    auto* cameraSink = new QVideoSink(&cameraItem);
+
+    VideoRenderer screen;
+    screen.setVideoSink(screenSink);
+    VideoRenderer camera;
+    camera.setVideoSink(cameraSink);
+
+    auto i420Buffer = std::make_shared<std::vector<uint8_t>>(links::video::i420Size(kWidth, kHeight), 0x80);
+    const links::video::I420FrameRef i420 =
+        links::video::I420Frame::wrap(kWidth, kHeight, i420Buffer->data(), i420Buffer);
+
+    constexpr int kWindowFrames = 60;
+    for (int i = 0; i < kWindowFrames; ++i) {
+        screen.updateYuvFrame(*i420);
+        screen.updateYuvFrame(*i420);
+        camera.updateYuvFrame(*i420);
+        // What the window emits on the GUI thread before each sync
+        emit window.afterAnimating();
+    }
+
+    const VideoRenderer::RenderStats screenStats = screen.renderStatistics();
+    const VideoRenderer::RenderStats cameraStats = camera.renderStatistics();
+    std::cout << "video renderer pacing: window_frames=" << kWindowFrames
+              << ", screen_presented=" << screenStats.framesPresented
+              << ", screen_dropped=" << screenStats.framesDropped
+              << ", camera_presented=" << cameraStats.framesPresented
+              << ", camera_dropped=" << cameraStats.framesDropped << std::endl;
+
+    EXPECT_EQ(screenStats.framesPresented, kWindowFrames);
+    EXPECT_EQ(screenStats.framesDropped, kWindowFrames);
+    EXPECT_EQ(cameraStats.framesPresented, kWindowFrames);
+    EXPECT_EQ(cameraStats.framesDropped, 0);
+    // Dropped frames are overwritten in place, never a fresh pool frame
+    EXPECT_EQ(screenStats.framesAllocated, cameraStats.framesAllocated);
+}
@@ -35,14 +35,14 @@ QImage toQImage(const core::RawImage& image)
     return copy;
 }
 
-QVariantMap makeWindowItem(int index, const core::WindowInfo& info, const QImage& thumbnail)
+QVariantMap makeWindowItem(int index, const core::WindowInfo& info, const QString& thumbnailSource)
 {
     const QString title = QString::fromStdString(info.title);
 
     QVariantMap item;
     item["index"] = index;
     item["title"] = title;
-    item["thumbnail"] = thumbnail;
+    item["thumbnail"] = thumbnailSource;
     item["tooltip"] = title;
     item["windowId"] = static_cast<qulonglong>(info.id);
     return item;
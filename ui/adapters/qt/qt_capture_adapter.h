@@ -11,7 +11,7 @@ namespace links {
 namespace qt_adapter {
 
 QImage toQImage(const core::RawImage& image);
-QVariantMap makeWindowItem(int index, const core::WindowInfo& info, const QImage& thumbnail);
+QVariantMap makeWindowItem(int index, const core::WindowInfo& info, const QString& thumbnailSource);
 
 }  // namespace qt_adapter
 }  // namespace links
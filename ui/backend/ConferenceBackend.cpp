@@ -1,4 +1,5 @@
 #include "ConferenceBackend.h"
+#include "VideoRenderer.h"
 #include "../utils/logger.h"
 #include "../utils/settings.h"
 #include <QJsonObject>
@@ -13,6 +14,20 @@ ConferenceBackend::ConferenceBackend(QObject* parent)
     , shareModeManager_(new ShareModeManager(this))
     , isHost_(false)
 {
+    // Tiles of a stream that ended are emptied through their frame routes
+    connect(this, &ConferenceBackend::remoteTrackEnded,
+            this, &ConferenceBackend::clearRoutedFrames);
+    connect(this, &ConferenceBackend::localCameraEnded,
+            this, [this]() { clearRoutedFrames("local", false); });
+    connect(this, &ConferenceBackend::localScreenShareEnded,
+            this, [this]() { clearRoutedFrames("local", true); });
+    
+    // mainVideoSource is derived from these
+    connect(this, &ConferenceBackend::mainParticipantChanged, this, &ConferenceBackend::mainVideoSourceChanged);
+    connect(this, &ConferenceBackend::camEnabledChanged, this, &ConferenceBackend::mainVideoSourceChanged);
+    connect(this, &ConferenceBackend::screenSharingChanged, this, &ConferenceBackend::mainVideoSourceChanged);
+    connect(this, &ConferenceBackend::showScreenShareInMainChanged, this, &ConferenceBackend::mainVideoSourceChanged);
+    connect(this, &ConferenceBackend::participantsChanged, this, &ConferenceBackend::mainVideoSourceChanged);
 }
 
 ConferenceBackend::~ConferenceBackend()
@@ -20,6 +35,18 @@ ConferenceBackend::~ConferenceBackend()
     if (conferenceManager_ && conferenceManager_->isConnected()) {
         conferenceManager_->disconnect();
     }
+    
+    const auto& router = VideoRenderer::frameRouter();
+    const links::video::FrameRouterStats& stats = router.stats();
+    QStringList roles;
+    for (const auto& entry : router.deliveriesByRole()) {
+        roles << QString("%1=%2").arg(QString::fromStdString(entry.first)).arg(entry.second);
+    }
+    Logger::instance().info(QString("Frame router: %1 frames, %2 deliveries (%3), %4 with no visible tile")
+                           .arg(stats.framesRouted)
+                           .arg(stats.deliveries)
+                           .arg(roles.join(", "))
+                           .arg(stats.framesUnrouted));
 }
 
 void ConferenceBackend::initialize(const QString& url, const QString& token,
@@ -99,6 +126,20 @@ void ConferenceBackend::setupConnections()
                 updateParticipantsList();
                 // Note: localCameraEnded is emitted from toggleCamera() method
             });
+    connect(conferenceManager_, &ConferenceManager::speakingChanged,
+            this, [this](const QString& identity, bool speaking) {
+                if (speaking) {
+                    speakingParticipants_.insert(identity);
+                } else {
+                    speakingParticipants_.remove(identity);
+                }
+                emit speakingChanged(identity, speaking);
+            });
+    connect(conferenceManager_, &ConferenceManager::activeSpeakersChanged,
+            this, [this](const QStringList& identities) {
+                activeSpeakers_ = identities;
+                emit activeSpeakersChanged();
+            });
 }
 
 // Property getters
@@ -225,6 +266,22 @@ void ConferenceBackend::toggleRemoteMainViewSource(const QString& participantId)
     updateParticipantsList();
 }
 
+QString ConferenceBackend::mainVideoSource() const
+{
+    // Only a participant sharing camera and screen has a choice; otherwise
+    // the main panel shows whichever stream there is
+    if (mainParticipantId_ == "local") {
+        if (!camEnabled() || !screenSharing()) {
+            return QString();
+        }
+        return showScreenShareInMain_ ? "screen" : "camera";
+    }
+    if (mainParticipantId_.isEmpty() || !screenShareState_.value(mainParticipantId_, false)) {
+        return QString();
+    }
+    return remoteShowScreenShareInMain_.value(mainParticipantId_, true) ? "screen" : "camera";
+}
+
 bool ConferenceBackend::getRemoteShowScreenInMain(const QString& participantId) const
 {
     return remoteShowScreenShareInMain_.value(participantId, true);
@@ -246,6 +303,13 @@ void ConferenceBackend::toggleMicrophone()
     }
 }
 
+void ConferenceBackend::releaseMicrophone()
+{
+    if (conferenceManager_) {
+        conferenceManager_->releaseMicrophone();
+    }
+}
+
 void ConferenceBackend::toggleCamera()
 {
     if (conferenceManager_) {
@@ -339,6 +403,13 @@ void ConferenceBackend::switchCamera(const QString& deviceId)
     }
 }
 
+void ConferenceBackend::setCameraQuality(const QString& quality)
+{
+    if (conferenceManager_) {
+        conferenceManager_->setCameraQuality(quality);
+    }
+}
+
 // UI controls
 void ConferenceBackend::toggleChat()
 {
@@ -442,6 +513,11 @@ bool ConferenceBackend::isParticipantCamEnabled(const QString& identity) const
     return camState_.value(identity, false);
 }
 
+bool ConferenceBackend::isParticipantSpeaking(const QString& identity) const
+{
+    return speakingParticipants_.contains(identity);
+}
+
 // Slots
 void ConferenceBackend::onConnected()
 {
@@ -529,7 +605,7 @@ void ConferenceBackend::onChatMessageReceived(const ChatMessage& message)
 
 void ConferenceBackend::onVideoFrameReceived(const QString& participantIdentity,
                                               const QString& trackSid,
-                                              const QImage& frame,
+                                              const links::video::I420FrameRef& frame,
                                               livekit::TrackSource source)
 {
     // Detect if this is a screen share track
@@ -564,22 +640,43 @@ void ConferenceBackend::onVideoFrameReceived(const QString& participantIdentity,
     // When not pinned and mainParticipantId_ is already set, don't switch
     // User must click to change the main participant
     
-    // Emit appropriate signal based on track type
-    if (isScreenShare) {
-        emit remoteScreenFrameReady(participantIdentity, frame);
-    } else {
-        emit remoteVideoFrameReady(participantIdentity, frame);
+    if (!frame) {
+        return;
     }
+    
+    // Straight to the tiles subscribed to this stream; QML only changes
+    // the subscriptions when the layout changes
+    const auto source = isScreenShare ? links::video::VideoViewSource::Screen
+                                      : links::video::VideoViewSource::Camera;
+    VideoRenderer::frameRouter().route(participantIdentity, source, [&frame](VideoRenderer* renderer) {
+        renderer->updateYuvFrame(*frame);
+    });
 }
 
 void ConferenceBackend::onLocalVideoFrameReady(const QImage& frame)
 {
-    emit localVideoFrameReady(frame);
+    VideoRenderer::frameRouter().route("local", links::video::VideoViewSource::Camera,
+                                       [&frame](VideoRenderer* renderer) {
+        renderer->updateImageFrame(frame);
+    });
 }
 
-void ConferenceBackend::onLocalScreenFrameReady(const QImage& frame)
+void ConferenceBackend::onLocalScreenFrameReady(const QImage& frame, const QRegion& updated)
 {
-    emit localScreenFrameReady(frame);
+    VideoRenderer::frameRouter().route("local", links::video::VideoViewSource::Screen,
+                                       [&frame, &updated](VideoRenderer* renderer) {
+        renderer->updateImageFrame(frame, updated);
+    });
+}
+
+void ConferenceBackend::clearRoutedFrames(const QString& participantId, bool isScreenShare)
+{
+    const auto source = isScreenShare ? links::video::VideoViewSource::Screen
+                                      : links::video::VideoViewSource::Camera;
+    const auto renderers = VideoRenderer::frameRouter().subscribers(participantId, source);
+    for (VideoRenderer* renderer : renderers) {
+        renderer->clearFrame();
+    }
 }
 
 void ConferenceBackend::onTrackSubscribed(const TrackInfo& track)
@@ -2,6 +2,8 @@
 #define CONFERENCE_BACKEND_H
 
 #include <QObject>
+#include <QSet>
+#include <QStringList>
 #include <QVariant>
 #include <QVariantList>
 #include <QImage>
@@ -47,6 +49,9 @@ class ConferenceBackend : public QObject
     Q_PROPERTY(QVariantList participants READ participants NOTIFY participantsChanged)
     Q_PROPERTY(QVariantList chatMessages READ chatMessages NOTIFY chatMessagesChanged)
     Q_PROPERTY(QString mainParticipantId READ mainParticipantId NOTIFY mainParticipantChanged)
+    // "camera" or "screen" when the main participant has both streams
+    Q_PROPERTY(QString mainVideoSource READ mainVideoSource NOTIFY mainVideoSourceChanged)
+    Q_PROPERTY(QStringList activeSpeakers READ activeSpeakers NOTIFY activeSpeakersChanged)
     
 public:
     explicit ConferenceBackend(QObject* parent = nullptr);
@@ -79,6 +84,8 @@ public:
     QVariantList participants() const { return participants_; }
     QVariantList chatMessages() const { return chatMessages_; }
     QString mainParticipantId() const { return mainParticipantId_; }
+    QString mainVideoSource() const;
+    QStringList activeSpeakers() const { return activeSpeakers_; }
     
     // Property setters
     void setIsChatVisible(bool visible);
@@ -90,6 +97,8 @@ public:
     
     // Media controls
     Q_INVOKABLE void toggleMicrophone();
+    // Closes the microphone device now instead of after the muted idle period
+    Q_INVOKABLE void releaseMicrophone();
     Q_INVOKABLE void toggleCamera();
     Q_INVOKABLE void toggleScreenShare();
     Q_INVOKABLE void startScreenShare(int screenIndex);
@@ -99,6 +108,7 @@ public:
     // Device switching during conference
     Q_INVOKABLE void switchMicrophone(const QString& deviceId);
     Q_INVOKABLE void switchCamera(const QString& deviceId);
+    Q_INVOKABLE void setCameraQuality(const QString& quality);
     
     // UI controls
     Q_INVOKABLE void toggleChat();
@@ -124,6 +134,7 @@ public:
     Q_INVOKABLE QVariantMap getParticipantInfo(const QString& identity) const;
     Q_INVOKABLE bool isParticipantMicEnabled(const QString& identity) const;
     Q_INVOKABLE bool isParticipantCamEnabled(const QString& identity) const;
+    Q_INVOKABLE bool isParticipantSpeaking(const QString& identity) const;
     
 signals:
     void roomNameChanged();
@@ -143,12 +154,8 @@ signals:
     void participantsChanged();
     void chatMessagesChanged();
     void mainParticipantChanged();
-    
-    // Video frame signals for QML video renderers
-    void localVideoFrameReady(const QImage& frame);
-    void localScreenFrameReady(const QImage& frame);
-    void remoteVideoFrameReady(const QString& participantId, const QImage& frame);
-    void remoteScreenFrameReady(const QString& participantId, const QImage& frame);
+    void mainVideoSourceChanged();
+    void activeSpeakersChanged();
     
     // Navigation
     void leaveRequested();
@@ -161,6 +168,7 @@ signals:
     void remoteTrackEnded(const QString& participantId, bool isScreenShare);  // Emitted when remote track ends
     void localCameraEnded();  // Emitted when local camera is turned off
     void localScreenShareEnded();  // Emitted when local screen share is stopped
+    void speakingChanged(const QString& participantId, bool speaking);  // Emitted on speaking transitions only
     
 private slots:
     void onConnected();
@@ -171,10 +179,10 @@ private slots:
     void onChatMessageReceived(const ChatMessage& message);
     void onVideoFrameReceived(const QString& participantIdentity,
                               const QString& trackSid,
-                              const QImage& frame,
+                              const links::video::I420FrameRef& frame,
                               livekit::TrackSource source);
     void onLocalVideoFrameReady(const QImage& frame);
-    void onLocalScreenFrameReady(const QImage& frame);
+    void onLocalScreenFrameReady(const QImage& frame, const QRegion& updated);
     void onTrackMutedStateChanged(const QString& trackSid, const QString& id,
                                   livekit::TrackKind kind, bool muted);
     void onTrackUnsubscribed(const QString& trackSid, const QString& participantIdentity);
@@ -185,6 +193,8 @@ private slots:
 private:
     void setupConnections();
     void updateParticipantsList();
+    // Empties the tiles subscribed to a stream that ended
+    void clearRoutedFrames(const QString& participantId, bool isScreenShare);
     void addChatMessage(const ChatMessage& msg);
     
     // Core
@@ -223,6 +233,8 @@ private:
     QMap<QString, QString> nameMap_;
     QMap<QString, bool> mutedParticipants_;
     QMap<QString, bool> hiddenVideoParticipants_;
+    QSet<QString> speakingParticipants_;
+    QStringList activeSpeakers_;  // Speaking participants, loudest first (updated at most 5x per second)
     
     // Track mapping: trackSid -> {participantId, isScreenShare}
     QMap<QString, QPair<QString, bool>> trackInfoMap_;
@@ -0,0 +1,72 @@
+#include "FramePacer.h"
+#include "VideoRenderer.h"
+#include "../utils/logger.h"
+#include <QQuickWindow>
+#include <algorithm>
+
+FramePacer* FramePacer::forWindow(QQuickWindow* window)
+{
+    if (!window) {
+        return nullptr;
+    }
+    auto* pacer = window->findChild<FramePacer*>(QString(), Qt::FindDirectChildrenOnly);
+    return pacer ? pacer : new FramePacer(window);
+}
+
+FramePacer::FramePacer(QQuickWindow* window)
+    : QObject(window)
+    , window_(window)
+{
+    // afterAnimating is the last point on the GUI thread before the render
+    // thread syncs (beforeSynchronizing runs on the render thread, where
+    // sinks and their VideoOutputs must not be touched). Frames presented
+    // here are picked up by this very sync.
+    connect(window, &QQuickWindow::afterAnimating, this, &FramePacer::flush);
+}
+
+FramePacer::~FramePacer()
+{
+    if (batches_ > 0) {
+        Logger::instance().info(QString("Frame pacer: %1 video frames in %2 window frames (%3 per sync)")
+                               .arg(framesPresented_)
+                               .arg(batches_)
+                               .arg(static_cast<double>(framesPresented_) / batches_, 0, 'f', 2));
+    }
+}
+
+void FramePacer::schedule(VideoRenderer* renderer)
+{
+    if (!pending_.contains(renderer)) {
+        pending_.append(renderer);
+    }
+    // One update per window frame, however many renderers have news
+    if (!updateRequested_ && window_) {
+        updateRequested_ = true;
+        window_->update();
+    }
+}
+
+void FramePacer::cancel(VideoRenderer* renderer)
+{
+    pending_.removeAll(renderer);
+    std::replace(flushing_.begin(), flushing_.end(), renderer, static_cast<VideoRenderer*>(nullptr));
+}
+
+void FramePacer::flush()
+{
+    updateRequested_ = false;
+    if (pending_.isEmpty()) {
+        return;
+    }
+
+    // Renderers scheduled while presenting wait for the next frame
+    flushing_.swap(pending_);
+    ++batches_;
+    framesPresented_ += flushing_.size();
+    for (VideoRenderer* renderer : std::as_const(flushing_)) {
+        if (renderer) {
+            renderer->presentPendingFrame();
+        }
+    }
+    flushing_.clear();
+}
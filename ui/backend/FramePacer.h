@@ -0,0 +1,51 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <QList>
+#include <QObject>
+#include <QPointer>
+
+class QQuickWindow;
+class VideoRenderer;
+
+/**
+ * @brief Hands video frames to their sinks once per frame of a window.
+ *
+ * Renderers keep only their newest frame and schedule themselves here. On
+ * the window's next frame the pacer pushes every pending frame to its sink
+ * in one batch, right before the scene graph syncs, so a 60 fps screen
+ * share and several 30 fps cameras cost one sync per display refresh
+ * instead of one per arriving frame. GUI thread only.
+ */
+class FramePacer : public QObject
+{
+    Q_OBJECT
+
+public:
+    // The pacer of |window|, created on first use and owned by the window
+    static FramePacer* forWindow(QQuickWindow* window);
+
+    ~FramePacer() override;
+
+    QQuickWindow* window() const { return window_; }
+
+    // Asks for |renderer|'s pending frame to be presented on the next frame
+    void schedule(VideoRenderer* renderer);
+    // Forgets a scheduled renderer (destroyed, cleared or moved)
+    void cancel(VideoRenderer* renderer);
+
+private:
+    explicit FramePacer(QQuickWindow* window);
+
+    void flush();
+
+    QPointer<QQuickWindow> window_;
+    QList<VideoRenderer*> pending_;
+    QList<VideoRenderer*> flushing_;  // batch being presented, reused
+    bool updateRequested_{false};
+
+    qint64 batches_{0};        // window frames that presented video
+    qint64 framesPresented_{0};
+};
+
+#endif // FRAMEPACER_H
@@ -0,0 +1,232 @@
+#include "LinksVideoItem.h"
+#include "../utils/logger.h"
+#include <QQuickWindow>
+#include <QSGSimpleTextureNode>
+#include <QSGTexture>
+#include <rhi/qrhi.h>
+
+namespace {
+
+/**
+ * Texture kept across frames. The GUI side hands it the newest picture and
+ * the rects to upload; the scene graph calls commitTextureOperations when
+ * it draws, and only then are pixels sent to the GPU. Rects handed over
+ * while a previous set is still waiting are merged with it.
+ */
+class VideoTexture : public QSGTexture
+{
+public:
+    ~VideoTexture() override
+    {
+        // The renderer may still reference it in the frame being recorded
+        if (texture_) {
+            texture_->deleteLater();
+        }
+    }
+
+    // Called from updatePaintNode while the GUI thread is blocked
+    void setContent(const QImage& image, const QRegion& dirty, bool wholeFrame)
+    {
+        image_ = image;
+        if (wholeFrame || image.size() != size_) {
+            uploadWhole_ = true;
+            dirty_ = QRegion();
+        } else if (!uploadWhole_) {
+            dirty_ += dirty;
+        }
+        size_ = image.size();
+    }
+
+    qint64 comparisonKey() const override { return qint64(quintptr(this)); }
+    QRhiTexture* rhiTexture() const override { return texture_; }
+    QSize textureSize() const override { return size_; }
+    bool hasAlphaChannel() const override { return false; }
+    bool hasMipmaps() const override { return false; }
+
+    void commitTextureOperations(QRhi* rhi, QRhiResourceUpdateBatch* resourceUpdates) override
+    {
+        if (image_.isNull()) {
+            return;
+        }
+        if (!texture_ || texture_->pixelSize() != size_) {
+            if (texture_) {
+                texture_->deleteLater();
+            }
+            texture_ = rhi->newTexture(QRhiTexture::RGBA8, size_);
+            if (!texture_->create()) {
+                Logger::instance().error(QString("LinksVideoItem: failed to create %1x%2 texture")
+                                             .arg(size_.width()).arg(size_.height()));
+                delete texture_;
+                texture_ = nullptr;
+                return;
+            }
+            uploadWhole_ = true;
+        }
+
+        if (uploadWhole_) {
+            resourceUpdates->uploadTexture(texture_, image_);
+        } else if (!dirty_.isEmpty()) {
+            QList<QRhiTextureUploadEntry> entries;
+            for (const QRect& rect : dirty_) {
+                QRhiTextureSubresourceUploadDescription description(image_);
+                description.setSourceTopLeft(rect.topLeft());
+                description.setSourceSize(rect.size());
+                description.setDestinationTopLeft(rect.topLeft());
+                entries.append(QRhiTextureUploadEntry(0, 0, description));
+            }
+            QRhiTextureUploadDescription upload;
+            upload.setEntries(entries.cbegin(), entries.cend());
+            resourceUpdates->uploadTexture(texture_, upload);
+        }
+        uploadWhole_ = false;
+        dirty_ = QRegion();
+    }
+
+private:
+    QImage image_;
+    QSize size_;
+    QRegion dirty_;
+    bool uploadWhole_{true};
+    QRhiTexture* texture_{nullptr};
+};
+
+}  // namespace
+
+LinksVideoItem::LinksVideoItem(QQuickItem* parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+}
+
+LinksVideoItem::~LinksVideoItem()
+{
+    if (stats_.framesReceived > 0) {
+        Logger::instance().info(
+            QString("LinksVideoItem: %1 frames, %2 unchanged, %3 coalesced; %4 full and %5 partial uploads "
+                    "(%6 MB), %7 textures")
+                .arg(stats_.framesReceived)
+                .arg(stats_.framesUnchanged)
+                .arg(stats_.framesCoalesced)
+                .arg(stats_.fullUploads)
+                .arg(stats_.partialUploads)
+                .arg(stats_.bytesUploaded / (1024.0 * 1024.0), 0, 'f', 1)
+                .arg(stats_.texturesCreated));
+    }
+}
+
+void LinksVideoItem::setMirrored(bool mirrored)
+{
+    if (mirrored_ != mirrored) {
+        mirrored_ = mirrored;
+        update();
+        emit mirroredChanged();
+    }
+}
+
+void LinksVideoItem::setFrame(const QImage& frame)
+{
+    setFrame(frame, QRegion(frame.rect()));
+}
+
+void LinksVideoItem::setFrame(const QImage& frame, const QRegion& updated)
+{
+    if (frame.isNull()) {
+        return;
+    }
+    ++stats_.framesReceived;
+
+    const bool resized = frame.size() != frame_.size();
+    if (!resized && updated.isEmpty()) {
+        ++stats_.framesUnchanged;
+        return;
+    }
+    if (contentPending_) {
+        ++stats_.framesCoalesced;
+    }
+
+    // RGBA8888 is the texture's layout byte for byte; the screen capturer
+    // already delivers it
+    frame_ = frame.format() == QImage::Format_RGBA8888 ? frame
+                                                      : frame.convertToFormat(QImage::Format_RGBA8888);
+    if (resized) {
+        wholeFrameDirty_ = true;
+        dirty_ = QRegion();
+    } else if (!wholeFrameDirty_) {
+        dirty_ += updated.intersected(frame_.rect());
+    }
+    contentPending_ = true;
+    update();
+}
+
+void LinksVideoItem::clearFrame()
+{
+    frame_ = QImage();
+    dirty_ = QRegion();
+    wholeFrameDirty_ = false;
+    contentPending_ = false;
+    update();
+}
+
+QSGNode* LinksVideoItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto* node = static_cast<QSGSimpleTextureNode*>(oldNode);
+
+    if (frame_.isNull() || width() <= 0 || height() <= 0) {
+        delete node;
+        return nullptr;
+    }
+
+    if (!node) {
+        node = new QSGSimpleTextureNode();
+        node->setOwnsTexture(true);
+        node->setFiltering(QSGTexture::Linear);
+        node->setTexture(new VideoTexture());
+        wholeFrameDirty_ = true;
+    }
+    auto* texture = static_cast<VideoTexture*>(node->texture());
+
+    if (contentPending_ || wholeFrameDirty_) {
+        if (texture->textureSize() != frame_.size()) {
+            ++stats_.texturesCreated;
+            wholeFrameDirty_ = true;
+        }
+
+        // Many scattered rects, or most of the picture, go up in one piece
+        const qint64 frameArea = static_cast<qint64>(frame_.width()) * frame_.height();
+        qint64 dirtyArea = 0;
+        for (const QRect& rect : dirty_) {
+            dirtyArea += static_cast<qint64>(rect.width()) * rect.height();
+        }
+        const bool whole = wholeFrameDirty_ || dirty_.rectCount() > kMaxPartialRects
+                           || dirtyArea > frameArea * kMaxPartialArea;
+
+        texture->setContent(frame_, dirty_, whole);
+        if (whole) {
+            ++stats_.fullUploads;
+            stats_.bytesUploaded += frameArea * 4;
+        } else {
+            ++stats_.partialUploads;
+            stats_.bytesUploaded += dirtyArea * 4;
+        }
+        node->markDirty(QSGNode::DirtyMaterial);
+
+        dirty_ = QRegion();
+        wholeFrameDirty_ = false;
+        contentPending_ = false;
+    }
+
+    // Letterboxed like VideoOutput's PreserveAspectFit
+    const QSizeF fitted = QSizeF(frame_.size()).scaled(size(), Qt::KeepAspectRatio);
+    const QRectF target((width() - fitted.width()) / 2, (height() - fitted.height()) / 2,
+                        fitted.width(), fitted.height());
+    if (node->rect() != target) {
+        node->setRect(target);
+    }
+    const auto transform = mirrored_ ? QSGSimpleTextureNode::MirrorHorizontally
+                                     : QSGSimpleTextureNode::NoTransform;
+    if (node->textureCoordinatesTransform() != transform) {
+        node->setTextureCoordinatesTransform(transform);
+    }
+    return node;
+}
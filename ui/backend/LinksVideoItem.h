@@ -0,0 +1,76 @@
+#ifndef LINKSVIDEOITEM_H
+#define LINKSVIDEOITEM_H
+
+#include <QImage>
+#include <QQuickItem>
+#include <QRegion>
+
+/**
+ * @brief Video surface that keeps one GPU texture per tile and updates it
+ * in place.
+ *
+ * VideoOutput re-uploads the whole picture for every frame. This item owns
+ * a persistent texture, reuses it while frames keep their size, and for
+ * frames that say which part changed (the local screen share) uploads only
+ * those rectangles. A static screen therefore costs no uploads at all.
+ * Frames of a new size, frames without a region and heavily changed frames
+ * are uploaded whole.
+ *
+ * Frames are set on the GUI thread, typically by a VideoRenderer whose
+ * videoItem points here; the picture is letterboxed into the item.
+ */
+class LinksVideoItem : public QQuickItem
+{
+    Q_OBJECT
+
+    Q_PROPERTY(bool mirrored READ mirrored WRITE setMirrored NOTIFY mirroredChanged)
+
+public:
+    explicit LinksVideoItem(QQuickItem* parent = nullptr);
+    ~LinksVideoItem() override;
+
+    bool mirrored() const { return mirrored_; }
+    void setMirrored(bool mirrored);
+
+    // Whole new picture
+    void setFrame(const QImage& frame);
+    // Picture of which only |updated| differs from the previous one; an
+    // empty region means nothing changed
+    void setFrame(const QImage& frame, const QRegion& updated);
+    void clearFrame();
+
+    struct UploadStats {
+        qint64 framesReceived{0};
+        qint64 framesUnchanged{0};   // nothing to upload
+        qint64 framesCoalesced{0};   // replaced before the next sync
+        qint64 fullUploads{0};
+        qint64 partialUploads{0};
+        qint64 texturesCreated{0};
+        qint64 bytesUploaded{0};
+    };
+    UploadStats uploadStatistics() const { return stats_; }
+
+signals:
+    void mirroredChanged();
+
+protected:
+    QSGNode* updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    // Above this many rects or this share of the frame a single full
+    // upload is cheaper than many small ones
+    static constexpr int kMaxPartialRects = 32;
+    static constexpr double kMaxPartialArea = 0.5;
+
+    QImage frame_;
+    QRegion dirty_;           // changed since the last sync
+    bool wholeFrameDirty_{false};
+    bool contentPending_{false};
+    bool mirrored_{false};
+
+    // Written on the GUI thread and in updatePaintNode, while the GUI
+    // thread is blocked
+    UploadStats stats_;
+};
+
+#endif // LINKSVIDEOITEM_H
@@ -1,4 +1,5 @@
 #include "ScreenPickerBackend.h"
+#include "ThumbnailImageProvider.h"
 
 #include <QColor>
 #include <algorithm>
@@ -86,7 +87,8 @@ void ScreenPickerBackend::refreshScreens()
 
     for (int i = 0; i < screenList.size(); ++i) {
         QScreen* screen = screenList[i];
-        QImage thumb = grabScreenThumbnail(screen);
+        const QString source = ThumbnailCache::instance().insert(screenThumbnailKey(i),
+                                                                 grabScreenThumbnail(screen));
         QString label = QString("屏幕 %1  (%2x%3)")
                             .arg(i + 1)
                             .arg(screen->geometry().width())
@@ -95,7 +97,7 @@ void ScreenPickerBackend::refreshScreens()
         QVariantMap item;
         item["index"] = i;
         item["title"] = label;
-        item["thumbnail"] = thumb;
+        item["thumbnail"] = source;
         item["tooltip"] = screen->name();
         screens_.append(item);
     }
@@ -113,6 +115,9 @@ void ScreenPickerBackend::refreshWindows()
 {
     cancelPendingOperations();
 
+    for (const auto& info : windowInfos_) {
+        ThumbnailCache::instance().remove(windowThumbnailKey(info.id));
+    }
     windows_.clear();
     windowInfos_.clear();
 
@@ -128,8 +133,9 @@ void ScreenPickerBackend::refreshWindows()
 
     for (int i = 0; i < static_cast<int>(windowInfos_.size()); ++i) {
         const auto& info = windowInfos_[i];
-        const QImage placeholder = placeholderThumbnail(QString::fromStdString(info.title));
-        windows_.append(links::qt_adapter::makeWindowItem(i, info, placeholder));
+        const QString source = ThumbnailCache::instance().insert(
+            windowThumbnailKey(info.id), placeholderThumbnail(QString::fromStdString(info.title)));
+        windows_.append(links::qt_adapter::makeWindowItem(i, info, source));
     }
 
     if (!windows_.isEmpty() && selectedWindowIndex_ < 0) {
@@ -180,7 +186,8 @@ void ScreenPickerBackend::captureWindowThumbnailsAsync()
 
 void ScreenPickerBackend::applyWindowThumbnails(const ThumbnailBatch& thumbnails)
 {
-    bool updated = false;
+    // Each tile is updated in place: the model entry only carries a URL, so
+    // bumping its version reloads one Image instead of resetting the grid.
     const int count = std::min(static_cast<int>(windows_.size()), static_cast<int>(thumbnails.size()));
 
     for (int i = 0; i < count; ++i) {
@@ -193,14 +200,12 @@ void ScreenPickerBackend::applyWindowThumbnails(const ThumbnailBatch& thumbnails
             continue;
         }
 
+        const QString source = ThumbnailCache::instance().insert(
+            windowThumbnailKey(windowInfos_[static_cast<std::size_t>(i)].id), thumb);
         QVariantMap item = windows_[i].toMap();
-        item["thumbnail"] = thumb;
+        item["thumbnail"] = source;
         windows_[i] = item;
-        updated = true;
-    }
-
-    if (updated) {
-        emit windowsChanged();
+        emit windowThumbnailUpdated(i, source);
     }
 }
 
@@ -235,6 +240,16 @@ QImage ScreenPickerBackend::grabScreenThumbnail(QScreen* screen) const
     return pix.scaled(kThumbSize, Qt::KeepAspectRatio, Qt::SmoothTransformation).toImage();
 }
 
+QString ScreenPickerBackend::windowThumbnailKey(links::core::WindowId id)
+{
+    return QString::number(static_cast<qulonglong>(id));
+}
+
+QString ScreenPickerBackend::screenThumbnailKey(int index)
+{
+    return QString("screen-%1").arg(index);
+}
+
 QImage ScreenPickerBackend::placeholderThumbnail(const QString& label) const
 {
     QPixmap pix(kThumbSize);
@@ -76,6 +76,7 @@ signals:
     void selectedScreenIndexChanged();
     void selectedWindowIndexChanged();
     void selectionChanged();
+    void windowThumbnailUpdated(int index, const QString& source);
     void accepted();
     void rejected();
 
@@ -86,6 +87,8 @@ private:
     std::vector<WindowInfo> enumerateWindows() const;
     QImage grabScreenThumbnail(QScreen* screen) const;
     QImage placeholderThumbnail(const QString& label) const;
+    static QString windowThumbnailKey(links::core::WindowId id);
+    static QString screenThumbnailKey(int index);
     void captureWindowThumbnailsAsync();
     void applyWindowThumbnails(const ThumbnailBatch& thumbnails);
     void clearThumbnailWatcher();
@@ -1,6 +1,7 @@
 #include "SettingsBackend.h"
 #include "../utils/settings.h"
 #include "../utils/logger.h"
+#include "video/camera_format_selector.h"
 #include <QMediaDevices>
 #include <QCameraDevice>
 #include <QAudioDevice>
@@ -8,7 +9,8 @@
 
 SettingsBackend::SettingsBackend(QObject* parent)
     : QObject(parent),
-      resolutions_({"1280x720", "1920x1080", "640x480"})
+      resolutions_({"320x240 · 15 fps", "640x480 · 30 fps", "1280x720 · 30 fps"}),
+      selectedResolutionIndex_(static_cast<int>(links::video::CameraQuality::Standard))
 {
     populateDevices();
     loadFromSettings();
@@ -183,6 +185,9 @@ void SettingsBackend::saveToSettings()
     settings.setSelectedCameraId(selectedCameraId_);
     settings.setSelectedMicrophoneId(selectedMicId_);
     settings.setSelectedSpeakerId(selectedSpeakerId_);
+    // Resolution entries are listed in CameraQuality order
+    settings.setCameraQuality(QString::fromLatin1(links::video::qualityName(
+        static_cast<links::video::CameraQuality>(selectedResolutionIndex_))));
     
     // Audio processing options
     settings.setEchoCancellationEnabled(echoCancel_);
@@ -202,6 +207,9 @@ void SettingsBackend::loadFromSettings()
     setSelectedCameraId(settings.getSelectedCameraId());
     setSelectedMicId(settings.getSelectedMicrophoneId());
     setSelectedSpeakerId(settings.getSelectedSpeakerId());
+    links::video::CameraQuality quality = links::video::CameraQuality::Standard;
+    links::video::parseQuality(settings.getCameraQuality().toStdString(), &quality);
+    setSelectedResolutionIndex(static_cast<int>(quality));
     
     // Audio processing options
     setEchoCancel(settings.isEchoCancellationEnabled());
@@ -0,0 +1,101 @@
+#include "ThumbnailImageProvider.h"
+
+#include <QReadLocker>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QWriteLocker>
+
+namespace {
+
+// Strips the "?v=N" cache-busting suffix QML passes through in the id
+QString keyFromId(const QString& id)
+{
+    const int query = id.indexOf(QLatin1Char('?'));
+    return query >= 0 ? id.left(query) : id;
+}
+
+class ThumbnailImageResponse : public QQuickImageResponse, public QRunnable
+{
+public:
+    ThumbnailImageResponse(const QString& key, const QSize& requestedSize)
+        : key_(key), requestedSize_(requestedSize)
+    {
+        setAutoDelete(false);
+    }
+
+    QQuickTextureFactory* textureFactory() const override
+    {
+        return QQuickTextureFactory::textureFactoryForImage(image_);
+    }
+
+    void run() override
+    {
+        image_ = ThumbnailCache::instance().image(key_);
+        if (!image_.isNull() && requestedSize_.isValid()
+            && (image_.width() > requestedSize_.width() || image_.height() > requestedSize_.height())) {
+            image_ = image_.scaled(requestedSize_, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }
+        emit finished();
+    }
+
+private:
+    QString key_;
+    QSize requestedSize_;
+    QImage image_;
+};
+
+}  // namespace
+
+ThumbnailCache& ThumbnailCache::instance()
+{
+    static ThumbnailCache instance;
+    return instance;
+}
+
+QString ThumbnailCache::insert(const QString& key, const QImage& image)
+{
+    QWriteLocker locker(&lock_);
+    Entry& entry = entries_[key];
+    entry.image = image;
+    entry.version = nextVersion_++;
+    return makeSource(key, entry.version);
+}
+
+QImage ThumbnailCache::image(const QString& key) const
+{
+    QReadLocker locker(&lock_);
+    const auto it = entries_.constFind(key);
+    return it != entries_.constEnd() ? it->image : QImage();
+}
+
+QString ThumbnailCache::source(const QString& key) const
+{
+    QReadLocker locker(&lock_);
+    const auto it = entries_.constFind(key);
+    return it != entries_.constEnd() ? makeSource(key, it->version) : QString();
+}
+
+void ThumbnailCache::remove(const QString& key)
+{
+    QWriteLocker locker(&lock_);
+    entries_.remove(key);
+}
+
+void ThumbnailCache::clear()
+{
+    QWriteLocker locker(&lock_);
+    entries_.clear();
+}
+
+QString ThumbnailCache::makeSource(const QString& key, quint64 version)
+{
+    return QString("image://%1/%2?v=%3").arg(kProviderId, key).arg(version);
+}
+
+QQuickImageResponse* ThumbnailImageProvider::requestImageResponse(const QString& id,
+                                                                  const QSize& requestedSize)
+{
+    auto* response = new ThumbnailImageResponse(keyFromId(id), requestedSize);
+    QThreadPool::globalInstance()->start(response);
+    return response;
+}
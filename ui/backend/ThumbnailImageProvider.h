@@ -0,0 +1,62 @@
+#ifndef THUMBNAILIMAGEPROVIDER_H
+#define THUMBNAILIMAGEPROVIDER_H
+
+#include <QHash>
+#include <QImage>
+#include <QQuickAsyncImageProvider>
+#include <QQuickImageResponse>
+#include <QReadWriteLock>
+#include <QSize>
+#include <QString>
+
+/**
+ * @brief Process-wide store for screen picker thumbnails.
+ *
+ * Thumbnails are keyed by a stable id (window id or "screen-<index>") and
+ * carry a version counter. QML references them through versioned URLs
+ * (image://thumbs/<key>?v=N), so replacing one thumbnail only invalidates
+ * the tile that shows it instead of the whole model.
+ */
+class ThumbnailCache
+{
+public:
+    static ThumbnailCache& instance();
+
+    // Stores the image and returns the versioned source URL for QML
+    QString insert(const QString& key, const QImage& image);
+    QImage image(const QString& key) const;
+    QString source(const QString& key) const;
+    void remove(const QString& key);
+    void clear();
+
+    static constexpr const char* kProviderId = "thumbs";
+
+private:
+    ThumbnailCache() = default;
+    ThumbnailCache(const ThumbnailCache&) = delete;
+    ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+
+    struct Entry {
+        QImage image;
+        quint64 version{0};
+    };
+
+    static QString makeSource(const QString& key, quint64 version);
+
+    mutable QReadWriteLock lock_;
+    QHash<QString, Entry> entries_;
+    quint64 nextVersion_{1};
+};
+
+/**
+ * @brief Serves ThumbnailCache entries to QML Image elements off the GUI thread.
+ */
+class ThumbnailImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    ThumbnailImageProvider() = default;
+
+    QQuickImageResponse* requestImageResponse(const QString& id, const QSize& requestedSize) override;
+};
+
+#endif  // THUMBNAILIMAGEPROVIDER_H
@@ -1,17 +1,54 @@
 #include "VideoRenderer.h"
+#include "FramePacer.h"
+#include "../core/video/video_kernels.h"
+#include "../core/video/video_view_registry.h"
+#include "../utils/logger.h"
+#include <QElapsedTimer>
 #include <QMutexLocker>
+#include <QPainter>
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QVideoFrameFormat>
+
+namespace {
+
+// Tiles name a participant's screen share "<identity>_screen"
+const QString kScreenShareSuffix = QStringLiteral("_screen");
+
+}  // namespace
 
 VideoRenderer::VideoRenderer(QObject* parent)
     : QObject(parent)
 {
 }
 
-VideoRenderer::~VideoRenderer() = default;
+VideoRenderer::~VideoRenderer()
+{
+    if (pacer_) {
+        pacer_->cancel(this);
+    }
+    frameRouter().unsubscribe(this);
+    links::video::VideoViewRegistry::instance().removeView(this);
+    logYuvStatistics();
+    
+    if (renderStats_.framesDropped > 0) {
+        Logger::instance().info(QString("Renderer %1 (%2): %3 frames presented, %4 replaced before the window's next frame")
+                               .arg(participantId_, viewRole_)
+                               .arg(renderStats_.framesPresented)
+                               .arg(renderStats_.framesDropped));
+    }
+}
 
 void VideoRenderer::setVideoSink(QVideoSink* sink)
 {
     if (videoSink_ != sink) {
-        videoSink_ = sink;
+        {
+            // The pool belongs to the sink that displays its frames
+            QMutexLocker locker(&mutex_);
+            cancelPendingFrame();
+            videoSink_ = sink;
+            framePool_.clear();
+        }
         emit videoSinkChanged();
     }
 }
@@ -20,6 +57,7 @@ void VideoRenderer::setParticipantId(const QString& id)
 {
     if (participantId_ != id) {
         participantId_ = id;
+        updateViewRegistration();
         emit participantIdChanged();
     }
 }
@@ -56,46 +94,315 @@ void VideoRenderer::setMirrored(bool mirrored)
     }
 }
 
-void VideoRenderer::updateFrame(const QImage& frame)
+void VideoRenderer::setVideoSource(const QString& source)
+{
+    if (videoSource_ != source) {
+        videoSource_ = source;
+        updateViewRegistration();
+        emit videoSourceChanged();
+    }
+}
+
+void VideoRenderer::setViewVisible(bool visible)
+{
+    if (viewVisible_ != visible) {
+        viewVisible_ = visible;
+        updateViewRegistration();
+        emit viewVisibleChanged();
+    }
+}
+
+void VideoRenderer::setViewWidth(int width)
+{
+    if (viewWidth_ != width) {
+        viewWidth_ = width;
+        updateViewRegistration();
+        emit viewWidthChanged();
+    }
+}
+
+void VideoRenderer::setViewHeight(int height)
+{
+    if (viewHeight_ != height) {
+        viewHeight_ = height;
+        updateViewRegistration();
+        emit viewHeightChanged();
+    }
+}
+
+VideoFrameRouter& VideoRenderer::frameRouter()
+{
+    static VideoFrameRouter router;
+    return router;
+}
+
+void VideoRenderer::setViewRole(const QString& role)
+{
+    if (viewRole_ != role) {
+        viewRole_ = role;
+        updateViewRegistration();
+        emit viewRoleChanged();
+    }
+}
+
+void VideoRenderer::setVideoItem(LinksVideoItem* item)
+{
+    if (videoItem_ != item) {
+        {
+            // Frames go to the item from now on, or back to the sink
+            QMutexLocker locker(&mutex_);
+            cancelPendingFrame();
+            if (videoItem_) {
+                videoItem_->clearFrame();
+            }
+            videoItem_ = item;
+        }
+        emit videoItemChanged();
+    }
+}
+
+void VideoRenderer::updateViewRegistration()
+{
+    auto& registry = links::video::VideoViewRegistry::instance();
+    if (participantId_.isEmpty()) {
+        registry.removeView(this);
+        frameRouter().unsubscribe(this);
+        return;
+    }
+
+    QString participant = participantId_;
+    links::video::VideoViewSource source = links::video::VideoViewSource::Any;
+    if (videoSource_ == QLatin1String("camera")) {
+        source = links::video::VideoViewSource::Camera;
+    } else if (videoSource_ == QLatin1String("screen")) {
+        source = links::video::VideoViewSource::Screen;
+    }
+    if (participant.endsWith(kScreenShareSuffix)) {
+        participant.chop(kScreenShareSuffix.size());
+        source = links::video::VideoViewSource::Screen;
+    }
+
+    registry.updateView(this, participant.toStdString(), source, viewVisible_, viewWidth_, viewHeight_);
+    // Tiles off screen keep their route but are not uploaded to
+    frameRouter().subscribe(this, participant, source, viewRole_.toStdString(), viewVisible_);
+}
+
+void VideoRenderer::updateFrame(const QVariant& frame)
+{
+    if (frame.metaType() == QMetaType::fromType<links::video::I420FrameRef>()) {
+        const auto planar = frame.value<links::video::I420FrameRef>();
+        if (planar) {
+            updateYuvFrame(*planar);
+        }
+        return;
+    }
+    updateImageFrame(frame.value<QImage>());
+}
+
+void VideoRenderer::updateImageFrame(const QImage& frame)
+{
+    updateImageFrame(frame, QRegion(frame.rect()));
+}
+
+void VideoRenderer::updateImageFrame(const QImage& frame, const QRegion& updated)
 {
     if (frame.isNull()) return;
     
     QMutexLocker locker(&mutex_);
     
+    if (videoItem_) {
+        // The item keeps the previous picture and uploads only the changed
+        // region, on its own next scene graph sync
+        videoItem_->setMirrored(mirrored_);
+        videoItem_->setFrame(frame, updated);
+        ++renderStats_.framesPresented;
+        if (!hasFrame_) {
+            hasFrame_ = true;
+            emit hasFrameChanged();
+        }
+        return;
+    }
+    
     if (!videoSink_) return;
     
-    // Convert to format suitable for QVideoFrame
-    QImage convertedImage = frame;
-    if (frame.format() != QImage::Format_RGBA8888 && 
-        frame.format() != QImage::Format_RGB32) {
-        convertedImage = frame.convertToFormat(QImage::Format_RGBA8888);
+    if (QVideoFrameFormat::pixelFormatFromImageFormat(frame.format()) != QVideoFrameFormat::Format_Invalid) {
+        // The QVideoFrame shares the image's pixels, and mirroring is a flag
+        // the shader applies, so nothing is copied
+        QVideoFrame videoFrame(frame);
+        ++renderStats_.framesAllocated;
+        if (videoFrame.isValid()) {
+            videoFrame.setMirrored(mirrored_);
+            presentFrame(videoFrame);
+        }
+        return;
     }
     
-    // Apply mirroring if needed
-    if (mirrored_) {
-        convertedImage = convertedImage.mirrored(true, false);
+    // Other formats are converted straight into a pooled frame
+    QVideoFrameFormat format(frame.size(), QVideoFrameFormat::Format_RGBA8888);
+    format.setMirrored(mirrored_);
+    QVideoFrame videoFrame = nextPooledFrame(format);
+    if (!videoFrame.map(QVideoFrame::WriteOnly)) {
+        return;
+    }
+    {
+        QImage target(videoFrame.bits(0), videoFrame.width(), videoFrame.height(),
+                      videoFrame.bytesPerLine(0), QImage::Format_RGBA8888);
+        QPainter painter(&target);
+        painter.setCompositionMode(QPainter::CompositionMode_Source);
+        painter.drawImage(0, 0, frame);
     }
+    videoFrame.unmap();
+    renderStats_.bytesCopied += static_cast<qint64>(frame.width()) * frame.height() * 4;
+    presentFrame(videoFrame);
+}
+
+void VideoRenderer::updateYuvFrame(const links::video::I420Frame& frame)
+{
+    QMutexLocker locker(&mutex_);
     
-    // Create video frame from image
-    QVideoFrame videoFrame(convertedImage);
+    if (!videoSink_) return;
     
-    if (videoFrame.isValid()) {
-        videoSink_->setVideoFrame(videoFrame);
-        
-        if (!hasFrame_) {
-            hasFrame_ = true;
-            emit hasFrameChanged();
+    QElapsedTimer timer;
+    timer.start();
+    
+    QVideoFrameFormat format(QSize(frame.width(), frame.height()), QVideoFrameFormat::Format_YUV420P);
+    format.setMirrored(mirrored_);
+    QVideoFrame videoFrame = nextPooledFrame(format);
+    if (!videoFrame.map(QVideoFrame::WriteOnly)) {
+        return;
+    }
+    links::video::kernels::copyPlane(frame.y(), frame.strideY(), videoFrame.bits(0), videoFrame.bytesPerLine(0),
+                                     frame.width(), frame.height());
+    links::video::kernels::copyPlane(frame.u(), frame.strideU(), videoFrame.bits(1), videoFrame.bytesPerLine(1),
+                                     frame.chromaWidth(), frame.chromaHeight());
+    links::video::kernels::copyPlane(frame.v(), frame.strideV(), videoFrame.bits(2), videoFrame.bytesPerLine(2),
+                                     frame.chromaWidth(), frame.chromaHeight());
+    videoFrame.unmap();
+    renderStats_.bytesCopied += static_cast<qint64>(links::video::i420Size(frame.width(), frame.height()));
+    
+    yuvStats_.uploadNs += timer.nsecsElapsed();
+    ++yuvStats_.frames;
+    
+    presentFrame(videoFrame);
+}
+
+VideoRenderer::RenderStats VideoRenderer::renderStatistics() const
+{
+    QMutexLocker locker(&mutex_);
+    return renderStats_;
+}
+
+QQuickWindow* VideoRenderer::sinkWindow() const
+{
+    // VideoOutput owns the sink it exposes
+    const auto* item = qobject_cast<QQuickItem*>(videoSink_ ? videoSink_->parent() : nullptr);
+    return item ? item->window() : nullptr;
+}
+
+void VideoRenderer::presentFrame(const QVideoFrame& frame)
+{
+    QQuickWindow* window = sinkWindow();
+    if (!window) {
+        deliverFrame(frame);
+        return;
+    }
+    
+    if (!pacer_ || pacer_->window() != window) {
+        cancelPendingFrame();
+        pacer_ = FramePacer::forWindow(window);
+    }
+    
+    if (pendingFrame_.isValid()) {
+        // Already scheduled; only the newest frame is shown
+        ++renderStats_.framesDropped;
+        pendingFrame_ = frame;
+        return;
+    }
+    pendingFrame_ = frame;
+    pacer_->schedule(this);
+}
+
+void VideoRenderer::presentPendingFrame()
+{
+    QMutexLocker locker(&mutex_);
+    
+    if (!pendingFrame_.isValid() || !videoSink_) {
+        return;
+    }
+    const QVideoFrame frame = pendingFrame_;
+    pendingFrame_ = QVideoFrame();
+    deliverFrame(frame);
+}
+
+void VideoRenderer::cancelPendingFrame()
+{
+    pendingFrame_ = QVideoFrame();
+    if (pacer_) {
+        pacer_->cancel(this);
+    }
+}
+
+void VideoRenderer::deliverFrame(const QVideoFrame& frame)
+{
+    videoSink_->setVideoFrame(frame);
+    ++renderStats_.framesPresented;
+    
+    if (!hasFrame_) {
+        hasFrame_ = true;
+        emit hasFrameChanged();
+    }
+}
+
+QVideoFrame VideoRenderer::nextPooledFrame(const QVideoFrameFormat& format)
+{
+    if (framePool_.isEmpty() || framePool_.first().surfaceFormat() != format) {
+        framePool_.clear();
+        for (int i = 0; i < kFramePoolSize; ++i) {
+            framePool_.append(QVideoFrame(format));
         }
+        renderStats_.framesAllocated += kFramePoolSize;
+        nextPoolFrame_ = 0;
+    }
+    
+    // Nobody has seen the waiting frame yet, so it is rewritten rather than
+    // handing out one the scene graph may still be reading
+    if (pendingFrame_.isValid() && framePool_.contains(pendingFrame_)) {
+        return pendingFrame_;
+    }
+    
+    QVideoFrame frame = framePool_.at(nextPoolFrame_);
+    nextPoolFrame_ = (nextPoolFrame_ + 1) % kFramePoolSize;
+    return frame;
+}
+
+void VideoRenderer::logYuvStatistics()
+{
+    if (yuvStats_.frames == 0) {
+        return;
     }
+    
+    const double uploadUs = yuvStats_.uploadNs / 1000.0 / yuvStats_.frames;
+    Logger::instance().info(QString("Renderer %1: %2 YUV frames, upload %3 us/frame")
+                           .arg(participantId_)
+                           .arg(yuvStats_.frames)
+                           .arg(uploadUs, 0, 'f', 1));
+    yuvStats_ = YuvStats();
 }
 
 void VideoRenderer::clearFrame()
 {
     QMutexLocker locker(&mutex_);
     
+    cancelPendingFrame();
     if (videoSink_) {
         videoSink_->setVideoFrame(QVideoFrame());
     }
+    if (videoItem_) {
+        videoItem_->clearFrame();
+    }
+    
+    framePool_.clear();
+    logYuvStatistics();
     
     if (hasFrame_) {
         hasFrame_ = false;
@@ -6,7 +6,20 @@
 #include <QVideoFrame>
 #include <QImage>
 #include <QMutex>
+#include <QRegion>
 #include <QPointer>
+#include <QVariant>
+#include "LinksVideoItem.h"
+#include "../core/video/frame_router.h"
+#include "../core/video/i420_frame.h"
+
+class FramePacer;
+class QQuickWindow;
+class VideoRenderer;
+
+// Routes decoded and captured frames to the renderers that show them,
+// keyed by participant identity ("local" for this client)
+using VideoFrameRouter = links::video::FrameRouter<VideoRenderer, QString>;
 
 /**
  * @brief Video frame provider using QVideoSink for QML VideoOutput.
@@ -25,6 +38,20 @@ class VideoRenderer : public QObject
     Q_PROPERTY(bool camEnabled READ camEnabled WRITE setCamEnabled NOTIFY camEnabledChanged)
     Q_PROPERTY(bool mirrored READ mirrored WRITE setMirrored NOTIFY mirroredChanged)
     Q_PROPERTY(bool hasFrame READ hasFrame NOTIFY hasFrameChanged)
+    // What the tile shows, reported to the media pipeline so remote frames
+    // nobody sees are dropped and large ones are downscaled to the tile
+    Q_PROPERTY(QString videoSource READ videoSource WRITE setVideoSource NOTIFY videoSourceChanged)
+    Q_PROPERTY(bool viewVisible READ viewVisible WRITE setViewVisible NOTIFY viewVisibleChanged)
+    Q_PROPERTY(int viewWidth READ viewWidth WRITE setViewWidth NOTIFY viewWidthChanged)
+    Q_PROPERTY(int viewHeight READ viewHeight WRITE setViewHeight NOTIFY viewHeightChanged)
+    // Where the tile sits in the layout ("main", "sidebar", "gallery",
+    // "preview"). The renderer subscribes to frameRouter() with its
+    // participant, source and role; frames then reach it without QML.
+    Q_PROPERTY(QString viewRole READ viewRole WRITE setViewRole NOTIFY viewRoleChanged)
+    // Texture surface used instead of the sink when set. It keeps its
+    // texture across frames and uploads only what changed, so it suits the
+    // local screen share; it shows QImage frames only.
+    Q_PROPERTY(LinksVideoItem* videoItem READ videoItem WRITE setVideoItem NOTIFY videoItemChanged)
     
 public:
     explicit VideoRenderer(QObject* parent = nullptr);
@@ -41,6 +68,12 @@ public:
     bool camEnabled() const { return camEnabled_; }
     bool mirrored() const { return mirrored_; }
     bool hasFrame() const { return hasFrame_; }
+    QString videoSource() const { return videoSource_; }
+    bool viewVisible() const { return viewVisible_; }
+    int viewWidth() const { return viewWidth_; }
+    int viewHeight() const { return viewHeight_; }
+    QString viewRole() const { return viewRole_; }
+    LinksVideoItem* videoItem() const { return videoItem_; }
     
     // Property setters
     void setParticipantId(const QString& id);
@@ -48,11 +81,45 @@ public:
     void setMicEnabled(bool enabled);
     void setCamEnabled(bool enabled);
     void setMirrored(bool mirrored);
+    // "camera", "screen", or empty for whichever stream is routed here.
+    // A participantId ending in "_screen" always means the screen share.
+    void setVideoSource(const QString& source);
+    void setViewVisible(bool visible);
+    // Size on screen in device pixels
+    void setViewWidth(int width);
+    void setViewHeight(int height);
+    void setViewRole(const QString& role);
+    void setVideoItem(LinksVideoItem* item);
+    
+    // GUI thread only
+    static VideoFrameRouter& frameRouter();
     
-    // Frame update (called from C++)
-    Q_INVOKABLE void updateFrame(const QImage& frame);
+    // Frame update by hand, for renderers outside the router: a QImage or a
+    // links::video::I420FrameRef
+    Q_INVOKABLE void updateFrame(const QVariant& frame);
     Q_INVOKABLE void clearFrame();
     
+    // Packed RGB(A) frames. Formats QVideoFrame knows are wrapped without a
+    // copy; others are converted into a pooled frame.
+    void updateImageFrame(const QImage& frame);
+    // Frame of which only |updated| differs from the previous one (empty:
+    // nothing changed). A videoItem uploads just that region; the sink
+    // always takes the whole frame.
+    void updateImageFrame(const QImage& frame, const QRegion& updated);
+    // Planar frames, copied plane by plane into a pooled YUV420P QVideoFrame
+    // that VideoOutput converts on the GPU; no RGBA conversion on the way
+    void updateYuvFrame(const links::video::I420Frame& frame);
+    
+    // Cost of getting frames to the sink. Mirroring never copies: it is a
+    // flag on the frame (or the pooled frames' format) applied when drawing.
+    struct RenderStats {
+        qint64 framesPresented{0};
+        qint64 framesDropped{0};    // replaced by a newer one before the window's next frame
+        qint64 framesAllocated{0};  // QVideoFrames created, wrappers and pool fills
+        qint64 bytesCopied{0};      // pixel bytes written by the renderer
+    };
+    RenderStats renderStatistics() const;
+    
 signals:
     void videoSinkChanged();
     void participantIdChanged();
@@ -61,8 +128,31 @@ signals:
     void camEnabledChanged();
     void mirroredChanged();
     void hasFrameChanged();
+    void videoSourceChanged();
+    void viewVisibleChanged();
+    void viewWidthChanged();
+    void viewHeightChanged();
+    void viewRoleChanged();
+    void videoItemChanged();
     
 private:
+    friend class FramePacer;
+    
+    void updateViewRegistration();
+    // Sinks inside a window are updated on the window's frame clock: the
+    // newest frame waits for FramePacer, older ones are dropped. Sinks
+    // outside a scene are updated immediately.
+    void presentFrame(const QVideoFrame& frame);
+    void presentPendingFrame();
+    void deliverFrame(const QVideoFrame& frame);
+    void cancelPendingFrame();
+    QQuickWindow* sinkWindow() const;
+    // Next frame of the pool, refilled when the format (size, pixel format,
+    // mirroring) changes
+    QVideoFrame nextPooledFrame(const QVideoFrameFormat& format);
+    void logYuvStatistics();
+    
+
     QPointer<QVideoSink> videoSink_;
     QString participantId_;
     QString participantName_;
@@ -70,8 +160,34 @@ private:
     bool camEnabled_{true};
     bool mirrored_{false};
     bool hasFrame_{false};
+    QString videoSource_;
+    bool viewVisible_{false};
+    int viewWidth_{0};
+    int viewHeight_{0};
+    QString viewRole_;
+    QPointer<LinksVideoItem> videoItem_;
+    
+    // Frames the renderer writes into, recycled for the current sink. The
+    // sink and the scene graph hold at most the current and the previous
+    // frame, so with three in rotation the one written next is always free.
+    // A frame still waiting for the window is overwritten in place instead.
+    static constexpr int kFramePoolSize = 3;
+    QList<QVideoFrame> framePool_;
+    int nextPoolFrame_{0};
+    RenderStats renderStats_;
+    
+    QVideoFrame pendingFrame_;
+    QPointer<FramePacer> pacer_;
+    
+    // Upload cost of YUV frames (the RGBA conversion they avoid is measured
+    // in video_renderer_benchmarks, not here)
+    struct YuvStats {
+        qint64 frames{0};
+        qint64 uploadNs{0};
+    };
+    YuvStats yuvStats_;
     
-    QMutex mutex_;
+    mutable QMutex mutex_;
 };
 
 #endif // VIDEO_RENDERER_H
@@ -53,14 +53,13 @@ Window {
             id: videoRenderer
             videoSink: videoOutput.videoSink
             mirrored: true  // Mirror local camera
-        }
-        
-        // Connect to backend video frame signal
-        Connections {
-            target: root.backend
-            function onLocalVideoFrameReady(frame) {
-                videoRenderer.updateFrame(frame)
-            }
+            // Local camera frames are routed here while the preview is shown
+            participantId: "local"
+            videoSource: "camera"
+            viewRole: "preview"
+            viewVisible: root.visible && !root.minimized
+            viewWidth: Math.round(videoOutput.width * Screen.devicePixelRatio)
+            viewHeight: Math.round(videoOutput.height * Screen.devicePixelRatio)
         }
         
         // Video output display
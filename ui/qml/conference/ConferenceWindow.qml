@@ -36,99 +36,6 @@ Window {
         onLeaveRequested: Qt.callLater(function() { leaveDialog.open() })
         onShowSettings: settingsDialog.open()
         
-        // Video frame routing
-        onLocalVideoFrameReady: function(frame) {
-            // Always route to sidebar for dual-stream mode (when camera shows in sidebar)
-            if (videoSidebar) videoSidebar.updateLocalFrame(frame)
-            
-            // Show camera in main when:
-            // - Single stream mode (camera only, no screen share), OR
-            // - Dual stream mode with showScreenShareInMain = false (camera in main)
-            var hasDualStreams = backend.camEnabled && backend.screenSharing
-            var showCameraInMain = !hasDualStreams || !backend.showScreenShareInMain
-            
-            if (backend.mainParticipantId === "local" && showCameraInMain && mainVideoPanel) {
-                mainVideoPanel.updateFrame(frame)
-            }
-            // Route to gallery view local thumbnail
-            // Show camera frames when: showing camera in dual-stream OR single-stream camera only
-            if (galleryView.visible && localGalleryThumbnail) {
-                var hasDualStreams = backend.camEnabled && backend.screenSharing
-                var shouldShowCamera = !hasDualStreams || !localGalleryCard.showingScreen
-                if (shouldShowCamera && backend.camEnabled) {
-                    localGalleryThumbnail.updateFrame(frame)
-                }
-            }
-        }
-        
-        onLocalScreenFrameReady: function(frame) {
-            // Route to sidebar for dual-stream mode (when screen shows in sidebar)
-            if (videoSidebar) videoSidebar.updateLocalScreenFrame(frame)
-            
-            // Show screen in main when:
-            // - mainParticipantId is "local", AND
-            // - Single stream mode (screen only, no camera), OR
-            // - Dual stream mode with showScreenShareInMain = true (screen in main)
-            var hasDualStreams = backend.camEnabled && backend.screenSharing
-            var showScreenInMain = !hasDualStreams || backend.showScreenShareInMain
-            
-            if (backend.mainParticipantId === "local" && backend.screenSharing && showScreenInMain && mainVideoPanel) {
-                mainVideoPanel.updateFrame(frame)
-            }
-            
-            // Route to gallery view local thumbnail
-            // Show screen frames when: showing screen in dual-stream OR single-stream screen only
-            if (galleryView.visible && localGalleryThumbnail) {
-                var hasDualStreamsLocal = backend.camEnabled && backend.screenSharing
-                var shouldShowScreen = !hasDualStreamsLocal || localGalleryCard.showingScreen
-                if (shouldShowScreen && backend.screenSharing) {
-                    localGalleryThumbnail.updateFrame(frame)
-                }
-            }
-        }
-        
-        onRemoteVideoFrameReady: function(participantId, frame) {
-            // Always route to sidebar for dual-stream mode (camera in sidebar when screen in main)
-            if (videoSidebar) videoSidebar.updateRemoteFrame(participantId, frame)
-            
-            // Show camera in main when:
-            // - Single stream mode (camera only, no screen share), OR
-            // - Dual stream mode with showScreenInMain = false (camera in main)
-            var hasScreenShare = backend.getRemoteScreenSharing(participantId)
-            var hasCam = true  // If we're receiving camera frames, camera is enabled
-            var hasDualStreams = hasCam && hasScreenShare
-            var showCameraInMain = !hasDualStreams || !backend.getRemoteShowScreenInMain(participantId)
-            
-            if (backend.mainParticipantId === participantId && showCameraInMain && mainVideoPanel) {
-                mainVideoPanel.updateFrame(frame)
-            }
-            // Also route to gallery view remote thumbnails (camera frames)
-            if (galleryView.visible) {
-                updateGalleryRemoteFrame(participantId, frame, false)
-            }
-        }
-        
-        onRemoteScreenFrameReady: function(participantId, frame) {
-            // Route to sidebar for dual-stream mode (screen in sidebar when camera in main)
-            if (videoSidebar) videoSidebar.updateRemoteScreenFrame(participantId, frame)
-            
-            // Show screen in main when:
-            // - Single stream mode (screen only, no camera), OR
-            // - Dual stream mode with showScreenInMain = true (screen in main)
-            var hasCam = true  // Assume camera is enabled if participant has known cam state
-            var hasDualStreams = hasCam && true  // Screen share is always enabled if receiving frames
-            var showScreenInMain = !hasDualStreams || backend.getRemoteShowScreenInMain(participantId)
-            
-            if (backend.mainParticipantId === participantId && showScreenInMain && mainVideoPanel) {
-                mainVideoPanel.updateFrame(frame)
-            }
-            
-            // Also route to gallery view remote thumbnails (screen frames)
-            if (galleryView.visible) {
-                updateGalleryRemoteFrame(participantId, frame, true)
-            }
-        }
-        
         onFullscreenChanged: {
             if (backend.isFullscreen) root.showFullScreen()
             else root.showNormal()
@@ -140,36 +47,6 @@ Window {
                 : (Qt.FramelessWindowHint | Qt.Window)
             root.show()
         }
-        
-        // Handle local camera ended - clear frames
-        onLocalCameraEnded: {
-            if (localGalleryThumbnail && typeof localGalleryThumbnail.clearFrame === 'function') {
-                localGalleryThumbnail.clearFrame()
-            }
-            if (backend.mainParticipantId === "local" && mainVideoPanel) {
-                mainVideoPanel.clearFrame()
-            }
-        }
-        
-        // Handle local screen share ended - clear frames
-        onLocalScreenShareEnded: {
-            if (localGalleryThumbnail && typeof localGalleryThumbnail.clearFrame === 'function') {
-                localGalleryThumbnail.clearFrame()
-            }
-            if (backend.mainParticipantId === "local" && mainVideoPanel) {
-                mainVideoPanel.clearFrame()
-            }
-        }
-        
-        // Handle remote track ended - clear frames
-        onRemoteTrackEnded: function(participantId, isScreenShare) {
-            // Clear main panel if this participant is displayed
-            if (backend.mainParticipantId === participantId && mainVideoPanel) {
-                mainVideoPanel.clearFrame()
-            }
-            // Clear gallery view thumbnails
-            clearGalleryRemoteFrame(participantId)
-        }
     }
     
     // Dynamic grid column calculation
@@ -181,63 +58,12 @@ Window {
         return 5
     }
     
-    // Gallery view remote frame routing
-    function updateGalleryRemoteFrame(participantId, frame, isScreenFrame) {
-        for (var i = 0; i < galleryRemoteRepeater.count; i++) {
-            var item = galleryRemoteRepeater.itemAt(i)
-            if (item && item.children) {
-                // Find the VideoThumbnail in the Rectangle's children
-                for (var j = 0; j < item.children.length; j++) {
-                    var child = item.children[j]
-                    if (child.participantId && child.participantId === participantId) {
-                        // Check if this card should receive this frame type
-                        var hasDualStreams = item.hasDualStreams || false
-                        var showingScreen = item.showingScreen || false
-                        
-                        // Determine if we should route this frame
-                        var shouldRoute = false
-                        if (hasDualStreams) {
-                            // In dual-stream mode, route based on which stream is being shown
-                            shouldRoute = (isScreenFrame === showingScreen)
-                        } else {
-                            // In single-stream mode, route if this is the only active stream type
-                            shouldRoute = true
-                        }
-                        
-                        if (shouldRoute) {
-                            child.updateFrame(frame)
-                        }
-                        return
-                    }
-                }
-            }
-        }
-    }
-    
     // Avatar color palette
     function getAvatarColor(index) {
         var colors = ["#3B82F6", "#10B981", "#8B5CF6", "#F59E0B", "#EC4899", "#06B6D4", "#EF4444", "#6366F1"]
         return colors[index % colors.length]
     }
     
-    // Clear gallery view remote frame when track ends
-    function clearGalleryRemoteFrame(participantId) {
-        for (var i = 0; i < galleryRemoteRepeater.count; i++) {
-            var item = galleryRemoteRepeater.itemAt(i)
-            if (item && item.children) {
-                for (var j = 0; j < item.children.length; j++) {
-                    var child = item.children[j]
-                    if (child.participantId && child.participantId === participantId) {
-                        if (typeof child.clearFrame === 'function') {
-                            child.clearFrame()
-                        }
-                        return
-                    }
-                }
-            }
-        }
-    }
-    
     // Main content
     Rectangle {
         id: windowFrame
@@ -394,6 +220,9 @@ Window {
                                     micEnabled: backend.micEnabled
                                     camEnabled: localGalleryCard.showingScreen ? true : (backend.camEnabled || backend.screenSharing)
                                     mirrored: !localGalleryCard.showingScreen
+                                    videoSource: localGalleryCard.hasDualStreams ? (localGalleryCard.showingScreen ? "screen" : "camera") : ""
+                                    viewRole: "gallery"
+                                    textureSurface: backend.screenSharing && (!localGalleryCard.hasDualStreams || localGalleryCard.showingScreen)
                                     showStatus: false // We use custom name label below
                                 }
                                 
@@ -540,6 +369,8 @@ Window {
                                         micEnabled: modelData.micEnabled
                                         camEnabled: remoteCard.showingScreen ? true : (modelData.camEnabled || modelData.screenSharing)
                                         mirrored: false
+                                        videoSource: remoteCard.hasDualStreams ? (remoteCard.showingScreen ? "screen" : "camera") : ""
+                                        viewRole: "gallery"
                                         showStatus: false // We use custom name label below
                                     }
                                     
@@ -678,12 +509,12 @@ Window {
                 backend: backend
                 settingsBackend: settingsBackendInstance
                 
-                onScreenShareClicked: {
-                    if (backend && backend.screenShareSupported) {
-                        screenPickerDialog.open()
-                    }
-                }
-            }
+                onScreenShareClicked: {
+                    if (backend && backend.screenShareSupported) {
+                        screenPickerDialog.open()
+                    }
+                }
+            }
         }
         
         // SettingsBackend for device selection in ControlBar
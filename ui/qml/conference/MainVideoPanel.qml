@@ -12,13 +12,24 @@ Rectangle {
     clip: true
     
     property ConferenceBackend backend
+    // Our own screen share changes little between frames; it is drawn
+    // through a texture that is only updated where the screen changed
+    readonly property bool textureSurface: backend !== null && backend.mainParticipantId === "local"
+                                           && backend.screenSharing && backend.mainVideoSource !== "camera"
     
     // Video renderer
     VideoRenderer {
         id: renderer
         participantId: backend ? backend.mainParticipantId : ""
+        videoSource: backend ? backend.mainVideoSource : ""
+        viewRole: "main"
         participantName: getDisplayName()
         videoSink: videoOutput.videoSink
+        videoItem: root.textureSurface ? textureItem : null
+        viewVisible: root.visible && root.Window.visibility !== Window.Minimized
+                     && root.Window.visibility !== Window.Hidden
+        viewWidth: Math.round(root.width * root.Screen.devicePixelRatio)
+        viewHeight: Math.round(root.height * root.Screen.devicePixelRatio)
         
         function getDisplayName() {
             if (!backend || !backend.mainParticipantId) return ""
@@ -27,10 +38,6 @@ Rectangle {
         }
     }
     
-    function updateFrame(frame) {
-        renderer.updateFrame(frame)
-    }
-    
     function clearFrame() {
         renderer.clearFrame()
     }
@@ -39,7 +46,13 @@ Rectangle {
     VideoOutput {
         id: videoOutput
         anchors.fill: parent
-        visible: renderer.hasFrame
+        visible: renderer.hasFrame && !root.textureSurface
+    }
+    
+    LinksVideoItem {
+        id: textureItem
+        anchors.fill: parent
+        visible: renderer.hasFrame && root.textureSurface
     }
     
     // Placeholder when no video
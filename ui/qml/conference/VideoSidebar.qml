@@ -19,84 +19,15 @@ Rectangle {
             root.remoteViewRefreshCounter++
         }
         
-        // Handle local camera ended - clear local camera frame
-        function onLocalCameraEnded() {
-            localVideoThumbnail.clearFrame()
-        }
-        
-        // Handle local screen share ended - clear local screen frame
-        function onLocalScreenShareEnded() {
-            localScreenThumbnail.clearFrame()
-        }
-        
-        // Handle track ended - clear the video frame to show placeholder
+        // Tiles of the ended track are cleared by the backend's frame router;
+        // force re-evaluation of UI state
         function onRemoteTrackEnded(participantId, isScreenShare) {
-            // Find the corresponding VideoThumbnail and clear its frame
-            for (var i = 0; i < remoteVideosList.count; i++) {
-                var item = remoteVideosList.itemAtIndex(i)
-                if (item) {
-                    if (isScreenShare) {
-                        // Clear screen share thumbnail
-                        var screenThumbnail = item.children[1]
-                        if (screenThumbnail && screenThumbnail.participantId === participantId + "_screen" 
-                            && typeof screenThumbnail.clearFrame === 'function') {
-                            screenThumbnail.clearFrame()
-                        }
-                    } else {
-                        // Clear camera thumbnail
-                        var camThumbnail = item.children[0]
-                        if (camThumbnail && camThumbnail.participantId === participantId
-                            && typeof camThumbnail.clearFrame === 'function') {
-                            camThumbnail.clearFrame()
-                        }
-                    }
-                }
-            }
-            // Force re-evaluation of UI state
             root.remoteViewRefreshCounter++
         }
     }
     
     signal thumbnailClicked(string participantId)
     
-    function updateLocalFrame(frame) {
-        localVideoThumbnail.updateFrame(frame)
-    }
-    
-    function updateLocalScreenFrame(frame) {
-        localScreenThumbnail.updateFrame(frame)
-    }
-    
-    function updateRemoteFrame(participantId, frame) {
-        // Find and update the remote camera thumbnail in the merged card
-        for (var i = 0; i < remoteVideosList.count; i++) {
-            var item = remoteVideosList.itemAtIndex(i)
-            // The delegate is a Rectangle (remoteCard), find the camera thumbnail inside
-            if (item) {
-                var camThumbnail = item.children[0]  // First child is remoteCamThumbnail
-                if (camThumbnail && camThumbnail.participantId === participantId) {
-                    camThumbnail.updateFrame(frame)
-                    break
-                }
-            }
-        }
-    }
-    
-    function updateRemoteScreenFrame(participantId, frame) {
-        // Find and update the remote screen thumbnail in the merged card
-        for (var i = 0; i < remoteVideosList.count; i++) {
-            var item = remoteVideosList.itemAtIndex(i)
-            // The delegate is a Rectangle (remoteCard), find the screen thumbnail inside
-            if (item) {
-                var screenThumbnail = item.children[1]  // Second child is remoteScreenThumbnail
-                if (screenThumbnail && screenThumbnail.participantId === participantId + "_screen") {
-                    screenThumbnail.updateFrame(frame)
-                    break
-                }
-            }
-        }
-    }
-    
     // Right border
     Rectangle {
         anchors.right: parent.right
@@ -134,6 +65,8 @@ Rectangle {
                 micEnabled: backend ? backend.micEnabled : false
                 camEnabled: backend ? backend.camEnabled : false
                 mirrored: true
+                videoSource: "camera"
+                viewRole: "sidebar"
                 
                 
                 // Removed: clicking thumbnail should not toggle source, only buttons do
@@ -147,6 +80,8 @@ Rectangle {
                 participantId: "local_screen"
                 participantName: "Screen"
                 showStatus: false
+                viewRole: "sidebar"
+                textureSurface: true
                 
                 
                 // Removed: clicking thumbnail should not toggle source, only buttons do
@@ -324,6 +259,8 @@ Rectangle {
                         participantName: modelData.name || modelData.identity
                         micEnabled: modelData.micEnabled
                         camEnabled: modelData.camEnabled
+                        videoSource: "camera"
+                        viewRole: "sidebar"
                         
                         // Removed: clicking thumbnail should not toggle source, only buttons do
                     }
@@ -336,6 +273,7 @@ Rectangle {
                         participantId: modelData.identity + "_screen"
                         participantName: modelData.name + " (Screen)"
                         showStatus: false
+                        viewRole: "sidebar"
                         
                         // Removed: clicking thumbnail should not toggle source, only buttons do
                     }
@@ -17,6 +17,14 @@ Rectangle {
     property bool camEnabled: false
     property bool mirrored: false
     property bool showStatus: true
+    // "camera" or "screen" when the tile shows one stream of the participant
+    property string videoSource: ""
+    // Where the tile sits ("main", "sidebar", "gallery"); frames are routed
+    // to it in C++ by participantId, videoSource and role
+    property string viewRole: ""
+    // Draw through a persistent texture that is updated only where the
+    // picture changed; for the local screen share
+    property bool textureSurface: false
     
     signal clicked()
     
@@ -29,10 +37,14 @@ Rectangle {
         camEnabled: root.camEnabled
         mirrored: root.mirrored
         videoSink: videoOutput.videoSink
-    }
-    
-    function updateFrame(frame) {
-        renderer.updateFrame(frame)
+        videoItem: root.textureSurface ? textureItem : null
+        // Remote frames are only processed for tiles on screen, at their size
+        videoSource: root.videoSource
+        viewRole: root.viewRole
+        viewVisible: root.visible && root.Window.visibility !== Window.Minimized
+                     && root.Window.visibility !== Window.Hidden
+        viewWidth: Math.round(root.width * root.Screen.devicePixelRatio)
+        viewHeight: Math.round(root.height * root.Screen.devicePixelRatio)
     }
     
     function clearFrame() {
@@ -61,7 +73,13 @@ Rectangle {
     VideoOutput {
         id: videoOutput
         anchors.fill: parent
-        visible: renderer.hasFrame
+        visible: renderer.hasFrame && !root.textureSurface
+    }
+    
+    LinksVideoItem {
+        id: textureItem
+        anchors.fill: parent
+        visible: renderer.hasFrame && root.textureSurface
     }
     
     // Placeholder when no video
@@ -42,7 +42,7 @@ Rectangle {
             required property var modelData
             required property int index
             
-            thumbnail: modelData.thumbnail
+            thumbnail: modelData.thumbnail || ""
             title: modelData.title || ""
             tooltipText: modelData.tooltip || ""
             selected: root.selectedIndex === index
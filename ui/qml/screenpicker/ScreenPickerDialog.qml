@@ -39,6 +39,10 @@ Popup {
             root.cancelled()
             root.close()
         }
+        
+        onWindowThumbnailUpdated: function(index, source) {
+            windowGrid.updateThumbnail(index, source)
+        }
     }
     
     // Expose backend for external access
@@ -1,13 +1,11 @@
 import QtQuick
 import QtQuick.Controls
-import QtMultimedia
-import Links.Backend 1.0
 
 Rectangle {
     id: root
     
     property string title: ""
-    property var thumbnail: null
+    property string thumbnail: ""
     property string tooltipText: ""
     property bool selected: false
     
@@ -44,35 +42,15 @@ Rectangle {
             color: "#F3F4F6"
             clip: true
             
-            // Use VideoRenderer with VideoOutput to display QImage
-            VideoRenderer {
-                id: imageRenderer
-                
-                function updateThumbnail() {
-                    // Only update if thumbnail is a valid QImage (not null/undefined/invalid)
-                    if (root.thumbnail && typeof root.thumbnail !== 'undefined') {
-                        try {
-                            imageRenderer.updateFrame(root.thumbnail)
-                        } catch (e) {
-                            // Ignore errors for invalid thumbnails
-                        }
-                    }
-                }
-            }
-            
-            VideoOutput {
-                id: videoOutput
+            // Served by the async "thumbs" image provider; the ?v=N suffix in
+            // the URL changes only when this tile's thumbnail is replaced
+            Image {
                 anchors.fill: parent
-                fillMode: VideoOutput.PreserveAspectFit
-                
-                Component.onCompleted: {
-                    imageRenderer.videoSink = videoOutput.videoSink
-                }
-            }
-            
-            // Initial update when component is ready
-            Component.onCompleted: {
-                Qt.callLater(imageRenderer.updateThumbnail)
+                source: root.thumbnail
+                sourceSize: Qt.size(width, height)
+                fillMode: Image.PreserveAspectFit
+                asynchronous: true
+                cache: false
             }
         }
         
@@ -89,11 +67,6 @@ Rectangle {
         }
     }
     
-    // Update when thumbnail property changes on root
-    onThumbnailChanged: {
-        imageRenderer.updateThumbnail()
-    }
-    
     MouseArea {
         id: mouseArea
         anchors.fill: parent
@@ -7,6 +7,14 @@ Rectangle {
     property var items: []
     property int selectedIndex: -1
     
+    // Swap a single tile's thumbnail without touching the model
+    function updateThumbnail(index, source) {
+        var tile = gridView.itemAtIndex(index)
+        if (tile) {
+            tile.thumbnail = source
+        }
+    }
+    
     color: "#FFFFFF"
     radius: 12
     border.color: "#E5E7EB"
@@ -42,7 +50,7 @@ Rectangle {
             required property var modelData
             required property int index
             
-            thumbnail: modelData.thumbnail
+            thumbnail: modelData.thumbnail || ""
             title: modelData.title || ""
             tooltipText: modelData.tooltip || ""
             selected: root.selectedIndex === index
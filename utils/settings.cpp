@@ -91,6 +91,26 @@ void Settings::setCameraEnabledByDefault(bool enabled)
     settings_.setValue("media/camera_enabled", enabled);
 }
 
+int Settings::getCameraStandbySeconds() const
+{
+    return settings_.value("media/camera_standby_s", 30).toInt();
+}
+
+void Settings::setCameraStandbySeconds(int seconds)
+{
+    settings_.setValue("media/camera_standby_s", seconds);
+}
+
+QString Settings::getCameraQuality() const
+{
+    return settings_.value("media/camera_quality", "standard").toString();
+}
+
+void Settings::setCameraQuality(const QString& quality)
+{
+    settings_.setValue("media/camera_quality", quality);
+}
+
 // Audio processing options
 bool Settings::isEchoCancellationEnabled() const
 {
@@ -122,6 +142,26 @@ void Settings::setAutoGainControlEnabled(bool enabled)
     settings_.setValue("audio/auto_gain_control", enabled);
 }
 
+bool Settings::isRealtimeAudioPriorityEnabled() const
+{
+    return settings_.value("audio/realtime_priority", true).toBool();
+}
+
+void Settings::setRealtimeAudioPriorityEnabled(bool enabled)
+{
+    settings_.setValue("audio/realtime_priority", enabled);
+}
+
+int Settings::getMicrophoneReleaseDelaySeconds() const
+{
+    return settings_.value("audio/mic_release_delay_s", 60).toInt();
+}
+
+void Settings::setMicrophoneReleaseDelaySeconds(int seconds)
+{
+    settings_.setValue("audio/mic_release_delay_s", seconds);
+}
+
 QString Settings::getSelectedCameraId() const
 {
     return settings_.value("device/camera_id", "").toString();
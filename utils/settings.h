@@ -30,6 +30,15 @@ public:
     bool isCameraEnabledByDefault() const;
     void setCameraEnabledByDefault(bool enabled);
     
+    // How long a turned-off camera stays open in standby before the device
+    // is released (0 disables standby)
+    int getCameraStandbySeconds() const;
+    void setCameraStandbySeconds(int seconds);
+    
+    // Camera capture quality profile ("low", "standard", "high")
+    QString getCameraQuality() const;
+    void setCameraQuality(const QString& quality);
+    
     // Audio processing options
     bool isEchoCancellationEnabled() const;
     void setEchoCancellationEnabled(bool enabled);
@@ -40,6 +49,15 @@ public:
     bool isAutoGainControlEnabled() const;
     void setAutoGainControlEnabled(bool enabled);
     
+    // Run microphone capture on a time-critical priority thread
+    bool isRealtimeAudioPriorityEnabled() const;
+    void setRealtimeAudioPriorityEnabled(bool enabled);
+    
+    // How long a muted microphone stays open before the device is released
+    // (0 releases it immediately on mute)
+    int getMicrophoneReleaseDelaySeconds() const;
+    void setMicrophoneReleaseDelaySeconds(int seconds);
+    
     // Device selection
     QString getSelectedCameraId() const;
     void setSelectedCameraId(const QString& deviceId);